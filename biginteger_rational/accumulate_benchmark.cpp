@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#ifndef BIGINTEGER_HEADER
+#define BIGINTEGER_HEADER "biginteger.h"
+#endif
+#include BIGINTEGER_HEADER
+
+BigInteger RandomInteger(std::mt19937_64& generator, size_t max_limbs) {
+  BigInteger shift(static_cast<unsigned long long>(1) << 32);
+  BigInteger answer = 0;
+  size_t limbs = 1 + generator() % max_limbs;
+  for (size_t i = 0; i < limbs; ++i) {
+    answer *= shift;
+    answer *= shift;
+    answer += BigInteger(static_cast<unsigned long long>(generator()));
+  }
+  return generator() % 2 == 0 ? answer : -answer;
+}
+
+template <typename Loop>
+void Measure(const char* name, size_t operations, Loop loop) {
+  auto start = std::chrono::steady_clock::now();
+  BigInteger result = loop();
+  auto finish = std::chrono::steady_clock::now();
+  double nanoseconds = std::chrono::duration<double, std::nano>(finish - start).count();
+  std::printf("%-18s %8.1f ms %8.1f ns/op  (%zu digits)\n", name, nanoseconds / 1e6,
+              nanoseconds / static_cast<double>(operations), result.toString().size());
+}
+
+int main() {
+  std::mt19937_64 generator(15);
+  std::vector<BigInteger> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back(RandomInteger(generator, 40));
+  }
+  std::vector<BigInteger> small;
+  for (int i = 0; i < 1000; ++i) {
+    small.push_back(RandomInteger(generator, 1));
+  }
+  Measure("mixed-sign sum", 400000, [&] {
+    BigInteger sum = 0;
+    for (int round = 0; round < 200; ++round) {
+      for (size_t i = 0; i < values.size(); ++i) {
+        sum += values[i];
+        sum -= values[(i + 7) % values.size()];
+      }
+    }
+    return sum;
+  });
+  Measure("small into large", 1000000, [&] {
+    BigInteger sum = values[0] * values[1];
+    for (int round = 0; round < 1000; ++round) {
+      for (const BigInteger& value : small) {
+        sum += value;
+      }
+    }
+    return sum;
+  });
+  Measure("increment", 3000000, [] {
+    BigInteger counter = 0;
+    for (int i = 0; i < 3000000; ++i) {
+      ++counter;
+    }
+    return counter;
+  });
+  Measure("decrement", 3000000, [] {
+    BigInteger counter = 1000000;
+    for (int i = 0; i < 3000000; ++i) {
+      --counter;
+    }
+    return counter;
+  });
+  return 0;
+}
@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstdio>
+
+#include "../benchmark/allocation_counter.h"
+
+#ifndef BIGINTEGER_HEADER
+#define BIGINTEGER_HEADER "biginteger.h"
+#endif
+#include BIGINTEGER_HEADER
+
+const int kIterations = 1000000;
+
+template <typename Operation>
+void Measure(const char* name, Operation operation) {
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 1; i <= kIterations; ++i) {
+    operation(i);
+  }
+  auto finish = std::chrono::steady_clock::now();
+  double nanoseconds = std::chrono::duration<double, std::nano>(finish - start).count();
+  std::printf("%-12s %8.2f allocations/op %10.1f ns/op\n", name,
+              static_cast<double>(allocations - before) / kIterations, nanoseconds / kIterations);
+}
+
+int main() {
+  BigInteger sum = 0;
+  BigInteger divisor = 97;
+  Measure("construct", [&](int i) {
+    BigInteger value(static_cast<int64_t>(i) * 1000003);
+    sum += value;
+  });
+  Measure("add", [&](int i) {
+    sum += BigInteger(i);
+  });
+  Measure("multiply", [&](int i) {
+    BigInteger value(i);
+    sum += value * value;
+  });
+  Measure("divide", [&](int i) {
+    BigInteger value(static_cast<int64_t>(i) << 20);
+    sum += value / divisor;
+  });
+  Measure("abs", [&](int i) {
+    BigInteger value(-i);
+    sum += value.Abs();
+  });
+  Measure("mixed", [&](int i) {
+    BigInteger value(i);
+    BigInteger square = value * value - value;
+    sum += square % divisor;
+    sum -= value.Abs() / BigInteger(3);
+  });
+  std::printf("checksum %s\n", sum.toString().c_str());
+  return 0;
+}
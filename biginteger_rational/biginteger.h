@@ -1,562 +1,2942 @@
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <vector>
 #include <cmath>
 #include <sstream>
 #include <cassert>
+#include <utility>
+#include <array>
+#include <stdexcept>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <iterator>
+#include <type_traits>
+#include <bit>
+#include <cstring>
+#include <string_view>
 
 enum Sign: int8_t {
   minus = -1, zero = 0, plus = 1
 };
 
-class BigInteger {
-private:
-  void DeleteExtraZeros() {
-    size_t length = nums_.size();
-    for (size_t i = length; i > 0; --i) {
-      if (nums_[i - 1] != 0) {
-        return;
+class LimbArithmetic {
+public:
+  using Limb = uint64_t;
+  using DoubleLimb = unsigned __int128;
+  static constexpr int kLimbBits = 64;
+  static constexpr DoubleLimb kBase = static_cast<DoubleLimb>(1) << kLimbBits;
+
+  static constexpr size_t Normalize(const Limb* first, size_t size) {
+    while (size > 0 && first[size - 1] == 0) {
+      --size;
+    }
+    return size;
+  }
+
+  static constexpr int Compare(const Limb* first, size_t first_size, const Limb* second, size_t second_size) {
+    first_size = Normalize(first, first_size);
+    second_size = Normalize(second, second_size);
+    if (first_size != second_size) {
+      return first_size < second_size ? -1 : 1;
+    }
+    for (size_t i = first_size; i > 0; --i) {
+      if (first[i - 1] != second[i - 1]) {
+        return first[i - 1] < second[i - 1] ? -1 : 1;
       }
-      nums_.pop_back();
     }
-    *this = 0;
+    return 0;
   }
 
-public:
-  static const int ns_ = 1e9;
-  Sign sign_;
-  std::vector<int> nums_;
+  static constexpr Limb Add(Limb* out, const Limb* first, size_t first_size, const Limb* second,
+                            size_t second_size) {
+    Limb carry = 0;
+    for (size_t i = 0; i < second_size; ++i) {
+      DoubleLimb sum = static_cast<DoubleLimb>(first[i]) + second[i] + carry;
+      out[i] = static_cast<Limb>(sum);
+      carry = static_cast<Limb>(sum >> kLimbBits);
+    }
+    for (size_t i = second_size; i < first_size; ++i) {
+      out[i] = first[i] + carry;
+      carry = out[i] < carry ? 1 : 0;
+    }
+    return carry;
+  }
 
-  BigInteger() : BigInteger(0) {}
+  static constexpr Limb Subtract(Limb* out, const Limb* first, size_t first_size, const Limb* second,
+                                 size_t second_size) {
+    Limb borrow = 0;
+    for (size_t i = 0; i < second_size; ++i) {
+      DoubleLimb difference = static_cast<DoubleLimb>(first[i]) - second[i] - borrow;
+      out[i] = static_cast<Limb>(difference);
+      borrow = static_cast<Limb>(difference >> kLimbBits) & 1;
+    }
+    for (size_t i = second_size; i < first_size; ++i) {
+      Limb value = first[i];
+      out[i] = value - borrow;
+      borrow = value < borrow ? 1 : 0;
+    }
+    return borrow;
+  }
 
-  BigInteger(int other) {
-    if (other == 0) {
-      sign_ = zero;
-      nums_.push_back(0);
-    } else if (other > 0) {
-      sign_ = plus;
-      while (other > 0) {
-        nums_.push_back(other % ns_);
-        other /= ns_;
-      }
-    } else {
-      *this = BigInteger(-other);
-      sign_ = minus;
+  static constexpr Limb MultiplySmall(Limb* out, const Limb* first, size_t size, Limb factor) {
+    DoubleLimb carry = 0;
+    for (size_t i = 0; i < size; ++i) {
+      DoubleLimb cur = static_cast<DoubleLimb>(first[i]) * factor + carry;
+      out[i] = static_cast<Limb>(cur % kBase);
+      carry = cur / kBase;
     }
+    return static_cast<Limb>(carry);
   }
 
-  explicit BigInteger(int64_t other) {
-    if (other == 0) {
-      sign_ = zero;
-      nums_.push_back(0);
-    } else if (other > 0) {
-      sign_ = plus;
-      std::string str;
-      while (other > 0) {
-        nums_.push_back(other % static_cast<int64_t>(ns_));
-        other /= ns_;
-      }
-    } else {
-      *this = BigInteger(-other);
-      sign_ = minus;
+  static constexpr Limb DivideSmall(Limb* out, const Limb* first, size_t size, Limb divisor) {
+    DoubleLimb remainder = 0;
+    for (size_t i = size; i > 0; --i) {
+      DoubleLimb cur = remainder * kBase + first[i - 1];
+      out[i - 1] = static_cast<Limb>(cur / divisor);
+      remainder = cur % divisor;
     }
+    return static_cast<Limb>(remainder);
   }
 
-  explicit BigInteger(unsigned long long other) {
-    if (other == 0) {
-      sign_ = zero;
-      nums_.push_back(0);
-    } else {
-      sign_ = plus;
-      std::string str;
-      while (other > 0) {
-        nums_.push_back(other % static_cast<int64_t>(ns_));
-        other /= ns_;
-      }
+  static constexpr bool SubtractMultiple(Limb* window, const Limb* divisor, size_t size, Limb factor) {
+    Limb carry = 0;
+    Limb borrow = 0;
+    for (size_t i = 0; i < size; ++i) {
+      DoubleLimb product = static_cast<DoubleLimb>(divisor[i]) * factor + carry;
+      carry = static_cast<Limb>(product >> kLimbBits);
+      DoubleLimb difference = static_cast<DoubleLimb>(window[i]) - static_cast<Limb>(product) - borrow;
+      window[i] = static_cast<Limb>(difference);
+      borrow = static_cast<Limb>(difference >> kLimbBits) & 1;
     }
+    DoubleLimb difference = static_cast<DoubleLimb>(window[size]) - carry - borrow;
+    window[size] = static_cast<Limb>(difference);
+    return (difference >> kLimbBits) != 0;
   }
 
-  BigInteger& operator+=(const BigInteger& other) {
-    if (other.sign_ == zero) {
-      return *this;
+  static constexpr Limb ShiftLeft(Limb* out, const Limb* first, size_t size, int shift) {
+    if (shift == 0) {
+      std::copy_backward(first, first + size, out + size);
+      return 0;
     }
-    if (other.sign_ == minus) {
-      return *this -= -other;
+    Limb carry = first[size - 1] >> (kLimbBits - shift);
+    for (size_t i = size - 1; i > 0; --i) {
+      out[i] = (first[i] << shift) | (first[i - 1] >> (kLimbBits - shift));
     }
-    if (sign_ == zero) {
-      *this = other;
-      return *this;
+    out[0] = first[0] << shift;
+    return carry;
+  }
+
+  static constexpr void ShiftRight(Limb* out, const Limb* first, size_t size, int shift) {
+    if (shift == 0) {
+      std::copy(first, first + size, out);
+      return;
     }
-    if (sign_ == minus) {
-      BigInteger temp = -*this;
-      temp -= other;
-      *this = -temp;
-      return *this;
+    for (size_t i = 0; i + 1 < size; ++i) {
+      out[i] = (first[i] >> shift) | (first[i + 1] << (kLimbBits - shift));
     }
-    size_t index = 0;
-    bool flag = false;
-    while (true) {
-      if (index < nums_.size() && index < other.nums_.size()) {
-        if (flag) {
-          if (nums_[index] + other.nums_[index] + 1 >= ns_) {
-            flag = true;
-            nums_[index] = nums_[index] + other.nums_[index] + 1 - ns_;
-          } else {
-            flag = false;
-            nums_[index] = nums_[index] + other.nums_[index] + 1;
-          }
-        } else {
-          if (nums_[index] + other.nums_[index] >= ns_) {
-            flag = true;
-            nums_[index] = nums_[index] + other.nums_[index] - ns_;
-          } else {
-            flag = false;
-            nums_[index] = nums_[index] + other.nums_[index];
-          }
-        }
-      } else if (index < nums_.size() && index >= other.nums_.size()) {
-        if (flag) {
-          if (nums_[index] + 1 >= ns_) {
-            flag = true;
-            nums_[index] = nums_[index] + 1 - ns_;
-          } else {
-            flag = false;
-            nums_[index] = nums_[index] + 1;
-          }
-        } else {
+    out[size - 1] = first[size - 1] >> shift;
+  }
+
+  static constexpr Limb AddMultiple(Limb* window, const Limb* source, size_t size, Limb factor) {
+    Limb carry = 0;
+    for (size_t i = 0; i < size; ++i) {
+      DoubleLimb sum = static_cast<DoubleLimb>(source[i]) * factor + window[i] + carry;
+      window[i] = static_cast<Limb>(sum);
+      carry = static_cast<Limb>(sum >> kLimbBits);
+    }
+    return carry;
+  }
+
+  static constexpr void DivideKnuth(Limb* quotient, Limb* remainder, const Limb* dividend, size_t dividend_size,
+                                    const Limb* divisor, size_t divisor_size, Limb* scratch) {
+    Limb* normalized_dividend = scratch;
+    Limb* normalized_divisor = scratch + dividend_size + 1;
+    Limb factor = static_cast<Limb>(kBase / (static_cast<DoubleLimb>(divisor[divisor_size - 1]) + 1));
+    normalized_dividend[dividend_size] = MultiplySmall(normalized_dividend, dividend, dividend_size, factor);
+    MultiplySmall(normalized_divisor, divisor, divisor_size, factor);
+    DoubleLimb top = normalized_divisor[divisor_size - 1];
+    DoubleLimb next = normalized_divisor[divisor_size - 2];
+    for (size_t j = dividend_size - divisor_size + 1; j > 0; --j) {
+      Limb* window = normalized_dividend + j - 1;
+      DoubleLimb numerator = static_cast<DoubleLimb>(window[divisor_size]) * kBase + window[divisor_size - 1];
+      DoubleLimb estimate = numerator / top;
+      DoubleLimb rest = numerator % top;
+      while (estimate >= kBase || estimate * next > rest * kBase + window[divisor_size - 2]) {
+        --estimate;
+        rest += top;
+        if (rest >= kBase) {
           break;
         }
-      } else if (index >= nums_.size() && index < other.nums_.size()) {
-        if (flag) {
-          if (other.nums_[index] + 1 >= ns_) {
-            flag = true;
-            nums_.push_back(other.nums_[index] + 1 - ns_);
-          } else {
-            flag = false;
-            nums_.push_back(other.nums_[index] + 1);
-          }
-        } else {
-          nums_.push_back(other.nums_[index]);
-        }
-      } else {
-        if (flag) {
-          nums_.push_back(1);
-        }
-        break;
       }
-      ++index;
+      if (SubtractMultiple(window, normalized_divisor, divisor_size, static_cast<Limb>(estimate))) {
+        --estimate;
+        window[divisor_size] += Add(window, window, divisor_size, normalized_divisor, divisor_size);
+      }
+      quotient[j - 1] = static_cast<Limb>(estimate);
     }
-    return *this;
+    DivideSmall(remainder, normalized_dividend, divisor_size, factor);
   }
 
-  BigInteger& operator-=(const BigInteger& other) {
-    if (other.sign_ == zero) {
-      return *this;
+  static constexpr void LinearCombination(Limb* out, const Limb* first, const Limb* second, size_t size,
+                                          int64_t first_factor, int64_t second_factor) {
+    __int128 carry = 0;
+    for (size_t i = 0; i < size; ++i) {
+      carry += static_cast<__int128>(first[i]) * first_factor + static_cast<__int128>(second[i]) * second_factor;
+      out[i] = static_cast<Limb>(carry);
+      carry >>= kLimbBits;
     }
-    if (other.sign_ == minus) {
-      return *this += -other;
+  }
+
+  static constexpr void MultiplySchoolbook(Limb* out, const Limb* first, size_t first_size, const Limb* second,
+                                           size_t second_size) {
+    std::fill(out, out + first_size + second_size, 0);
+    for (size_t i = 0; i < second_size; ++i) {
+      if (second[i] == 0) {
+        continue;
+      }
+      DoubleLimb carry = 0;
+      for (size_t j = 0; j < first_size; ++j) {
+        DoubleLimb cur = static_cast<DoubleLimb>(first[j]) * second[i] + out[i + j] + carry;
+        out[i + j] = static_cast<Limb>(cur % kBase);
+        carry = cur / kBase;
+      }
+      out[i + first_size] = static_cast<Limb>(carry);
     }
-    if (sign_ == zero) {
-      *this = -other;
-      return *this;
+  }
+};
+
+class NumberTheoreticTransform {
+private:
+  static constexpr uint32_t PowMod(uint64_t base, uint64_t power, uint32_t mod) {
+    uint64_t answer = 1;
+    base %= mod;
+    while (power > 0) {
+      if (power & 1) {
+        answer = answer * base % mod;
+      }
+      base = base * base % mod;
+      power >>= 1;
     }
-    if (sign_ == minus) {
-      BigInteger temp = -*this;
-      temp += other;
-      *this = -temp;
-      return *this;
+    return static_cast<uint32_t>(answer);
+  }
+
+  template <uint32_t kPrime, uint32_t kGenerator>
+  static void Transform(uint32_t* values, size_t size, bool inverse, std::vector<uint32_t>& roots) {
+    for (size_t i = 1, j = 0; i < size; ++i) {
+      size_t bit = size >> 1;
+      for (; j & bit; bit >>= 1) {
+        j ^= bit;
+      }
+      j ^= bit;
+      if (i < j) {
+        std::swap(values[i], values[j]);
+      }
     }
-    if (*this == other) {
-      *this = 0;
-      return *this;
+    roots.resize(size / 2);
+    uint32_t step = PowMod(kGenerator, (kPrime - 1) / size, kPrime);
+    if (inverse) {
+      step = PowMod(step, kPrime - 2, kPrime);
     }
-    if (*this < other) {
-      BigInteger temp = other;
-      temp -= *this;
-      *this = -temp;
-      return *this;
+    uint64_t root = 1;
+    for (size_t i = 0; i < size / 2; ++i) {
+      roots[i] = static_cast<uint32_t>(root);
+      root = root * step % kPrime;
     }
-    size_t index = 0;
-    bool flag = false;
-    while (true) {
-      if (index < other.nums_.size()) {
-        if (flag) {
-          if (nums_[index] - other.nums_[index] - 1 >= 0) {
-            flag = false;
-            nums_[index] = nums_[index] - other.nums_[index] - 1;
-          } else {
-            flag = true;
-            nums_[index] = nums_[index] - other.nums_[index] - 1 + ns_;
-          }
-        } else {
-          if (nums_[index] - other.nums_[index] >= 0) {
-            flag = false;
-            nums_[index] = nums_[index] - other.nums_[index];
-          } else {
-            flag = true;
-            nums_[index] = nums_[index] - other.nums_[index] + ns_;
-          }
-        }
-      } else {
-        if (flag) {
-          if (nums_[index] - 1 >= 0) {
-            flag = false;
-            nums_[index] = nums_[index] - 1;
-            break;
-          }
-          flag = true;
-          nums_[index] = nums_[index] - 1 + ns_;
-        } else {
-          break;
+    for (size_t length = 2; length <= size; length <<= 1) {
+      size_t half = length / 2;
+      size_t stride = size / length;
+      for (size_t start = 0; start < size; start += length) {
+        for (size_t i = 0; i < half; ++i) {
+          uint32_t low = values[start + i];
+          uint32_t high = static_cast<uint32_t>(static_cast<uint64_t>(values[start + i + half]) *
+                                                roots[i * stride] % kPrime);
+          values[start + i] = low + high >= kPrime ? low + high - kPrime : low + high;
+          values[start + i + half] = low >= high ? low - high : low + kPrime - high;
         }
       }
-      ++index;
     }
-    DeleteExtraZeros();
-    return *this;
+    if (inverse) {
+      uint64_t size_inverse = PowMod(size, kPrime - 2, kPrime);
+      for (size_t i = 0; i < size; ++i) {
+        values[i] = static_cast<uint32_t>(values[i] * size_inverse % kPrime);
+      }
+    }
   }
 
-  BigInteger& operator*=(const BigInteger& other) {
-    if (sign_ == zero || other.sign_ == zero) {
-      if (other.sign_ == zero) {
-        *this = other;
+  template <uint32_t kPrime>
+  static void Load(uint32_t* values, const LimbArithmetic::Limb* limbs, size_t size) {
+    for (size_t i = 0; i < size; ++i) {
+      for (size_t j = 0; j < kDigitsPerLimb; ++j) {
+        values[i * kDigitsPerLimb + j] = static_cast<uint32_t>(limbs[i] >> (j * kDigitBits)) % kPrime;
       }
-      return *this;
     }
-    std::vector<int64_t> rez;
-    for (size_t i = 0; i < other.nums_.size(); ++i) {
-      int64_t from_last = 0;
-      std::vector<int64_t> temp;
-      for (size_t j = 0; j < nums_.size(); ++j) {
-        if (i + j < rez.size()) {
-          int64_t num = static_cast<int64_t>(other.nums_[i]) * nums_[j] + from_last + rez[i + j];
-          rez[i + j] = num % ns_;
-          from_last = num / ns_;
-        } else {
-          int64_t num = static_cast<int64_t>(other.nums_[i]) * nums_[j] + from_last;
-          rez.push_back(num % ns_);
-          from_last = num / ns_;
-        }
-      }
-      if (from_last != 0) {
-        rez.push_back(from_last);
-      }
+  }
+
+  template <uint32_t kPrime, uint32_t kGenerator>
+  void Convolve(const LimbArithmetic::Limb* first, size_t first_size, const LimbArithmetic::Limb* second,
+                size_t second_size, size_t size, std::vector<uint32_t>& residues) {
+    residues.assign(size, 0);
+    Load<kPrime>(residues.data(), first, first_size);
+    Transform<kPrime, kGenerator>(residues.data(), size, false, roots_);
+    if (second != nullptr) {
+      buffer_.assign(size, 0);
+      Load<kPrime>(buffer_.data(), second, second_size);
+      Transform<kPrime, kGenerator>(buffer_.data(), size, false, roots_);
     }
-    if ((sign_ == minus && other.sign_ == plus) || (sign_ == plus && other.sign_ == minus)) {
-      sign_ = minus;
-    } else {
-      sign_ = plus;
+    const std::vector<uint32_t>& other = second != nullptr ? buffer_ : residues;
+    for (size_t i = 0; i < size; ++i) {
+      residues[i] = static_cast<uint32_t>(static_cast<uint64_t>(residues[i]) * other[i] % kPrime);
     }
-    nums_.clear();
-    for (size_t i = 0; i < rez.size(); ++i) {
-      nums_.push_back(static_cast<int>(rez[i]));
+    Transform<kPrime, kGenerator>(residues.data(), size, true, roots_);
+  }
+
+  void Recombine(LimbArithmetic::Limb* out, size_t total) const {
+    constexpr uint64_t kFirstInverse = PowMod(kFirstPrime, kSecondPrime - 2, kSecondPrime);
+    constexpr uint64_t kProductInverse =
+        PowMod(static_cast<uint64_t>(kFirstPrime) * kSecondPrime % kThirdPrime, kThirdPrime - 2, kThirdPrime);
+    constexpr uint64_t kFirstModThird = kFirstPrime % kThirdPrime;
+    constexpr unsigned __int128 kProduct = static_cast<unsigned __int128>(kFirstPrime) * kSecondPrime;
+    unsigned __int128 carry = 0;
+    for (size_t i = 0; i < total; ++i) {
+      LimbArithmetic::Limb limb = 0;
+      for (size_t j = 0; j < kDigitsPerLimb; ++j) {
+        size_t index = i * kDigitsPerLimb + j;
+        uint64_t first = first_residues_[index];
+        uint64_t second =
+            (second_residues_[index] + kSecondPrime - first % kSecondPrime) * kFirstInverse % kSecondPrime;
+        uint64_t partial = (first + second * kFirstModThird) % kThirdPrime;
+        uint64_t third = (third_residues_[index] + kThirdPrime - partial) * kProductInverse % kThirdPrime;
+        carry += first + static_cast<unsigned __int128>(second) * kFirstPrime + kProduct * third;
+        limb |= static_cast<LimbArithmetic::Limb>(static_cast<uint32_t>(carry)) << (j * kDigitBits);
+        carry >>= kDigitBits;
+      }
+      out[i] = limb;
     }
-    return *this;
   }
 
-  BigInteger& operator/=(const BigInteger&);
+  std::vector<uint32_t> first_residues_;
+  std::vector<uint32_t> second_residues_;
+  std::vector<uint32_t> third_residues_;
+  std::vector<uint32_t> buffer_;
+  std::vector<uint32_t> roots_;
 
-  BigInteger& operator%=(const BigInteger&);
+public:
+  static constexpr uint32_t kFirstPrime = 998244353;
+  static constexpr uint32_t kSecondPrime = 167772161;
+  static constexpr uint32_t kThirdPrime = 469762049;
+  static constexpr size_t kMaxSize = size_t(1) << 23;
+  static constexpr int kDigitBits = 32;
+  static constexpr size_t kDigitsPerLimb = LimbArithmetic::kLimbBits / kDigitBits;
+  static constexpr size_t kMaxLimbs = kMaxSize / kDigitsPerLimb;
 
-  void DivideTen() {
-    int deg = ns_ / 10;
-    nums_[0] /= 10;
-    for (size_t i = 1; i < nums_.size(); ++i) {
-      int num = nums_[i] % 10;
-      nums_[i - 1] += num * deg;
-      nums_[i] /= 10;
+  static size_t TransformSize(size_t total) {
+    size_t size = 1;
+    while (size < total) {
+      size <<= 1;
     }
-    DeleteExtraZeros();
+    return size;
   }
 
-  BigInteger operator-() const {
-    BigInteger answer = *this;
-    if (sign_ == plus) {
-      answer.sign_ = minus;
-    }
-    if (sign_ == minus) {
-      answer.sign_ = plus;
-    }
-    return answer;
+  void Multiply(LimbArithmetic::Limb* out, const LimbArithmetic::Limb* first, size_t first_size,
+                const LimbArithmetic::Limb* second, size_t second_size) {
+    size_t total = first_size + second_size;
+    size_t size = TransformSize(kDigitsPerLimb * total);
+    Convolve<kFirstPrime, 3>(first, first_size, second, second_size, size, first_residues_);
+    Convolve<kSecondPrime, 3>(first, first_size, second, second_size, size, second_residues_);
+    Convolve<kThirdPrime, 3>(first, first_size, second, second_size, size, third_residues_);
+    Recombine(out, total);
   }
 
-  BigInteger& operator++() {
-    *this += 1;
-    return *this;
+  void Square(LimbArithmetic::Limb* out, const LimbArithmetic::Limb* first, size_t size) {
+    size_t total = 2 * size;
+    size_t transform_size = TransformSize(kDigitsPerLimb * total);
+    Convolve<kFirstPrime, 3>(first, size, nullptr, 0, transform_size, first_residues_);
+    Convolve<kSecondPrime, 3>(first, size, nullptr, 0, transform_size, second_residues_);
+    Convolve<kThirdPrime, 3>(first, size, nullptr, 0, transform_size, third_residues_);
+    Recombine(out, total);
   }
+};
 
-  BigInteger operator++(int) {
-    BigInteger copy = *this;
-    *this += 1;
-    return copy;
+class Multiplier {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  std::vector<Limb> scratch_;
+  NumberTheoreticTransform ntt_;
+
+  static size_t KaratsubaThreshold() {
+    return std::max<size_t>(karatsuba_threshold_, 8);
   }
 
-  BigInteger& operator--() {
-    *this -= 1;
-    return *this;
+  static size_t Toom3Threshold() {
+    return std::max(toom3_threshold_, KaratsubaThreshold());
   }
 
-  BigInteger operator--(int) {
-    BigInteger copy = *this;
-    *this -= 1;
-    return copy;
+  static bool UseNtt(size_t first_size, size_t second_size) {
+    return std::min(first_size, second_size) >= ntt_threshold_ &&
+           first_size + second_size <= NumberTheoreticTransform::kMaxLimbs;
   }
 
-  bool operator==(const BigInteger& other) const {
-    if (sign_ != other.sign_ || nums_.size() != other.nums_.size()) {
-      return false;
+  static size_t ScratchSize(size_t size) {
+    if (size < KaratsubaThreshold()) {
+      return 0;
     }
-    for (size_t i = nums_.size(); i >= 1; --i) {
-      if (nums_[i - 1] != other.nums_[i - 1]) {
-        return false;
-      }
+    return 10 * size + 64 + ScratchSize(size / 2 + 2);
+  }
+
+  static void SignedAdd(Limb* out, bool& out_negative, const Limb* first, bool first_negative,
+                        const Limb* second, bool second_negative, size_t size) {
+    if (first_negative == second_negative) {
+      LimbArithmetic::Add(out, first, size, second, size);
+      out_negative = first_negative && LimbArithmetic::Normalize(out, size) != 0;
+      return;
+    }
+    int comparison = LimbArithmetic::Compare(first, size, second, size);
+    if (comparison >= 0) {
+      LimbArithmetic::Subtract(out, first, size, second, size);
+      out_negative = comparison > 0 && first_negative;
+    } else {
+      LimbArithmetic::Subtract(out, second, size, first, size);
+      out_negative = second_negative;
     }
-    return true;
   }
 
-  bool operator!=(const BigInteger& other) const { return !(*this == other); }
+  void MultiplyUnbalanced(Limb* out, const Limb* first, size_t first_size, const Limb* second,
+                                 size_t second_size, Limb* scratch) {
+    std::fill(out, out + first_size + second_size, 0);
+    Limb* product = scratch;
+    for (size_t offset = 0; offset < first_size; offset += second_size) {
+      size_t chunk = std::min(second_size, first_size - offset);
+      MultiplyRecursive(product, first + offset, chunk, second, second_size, scratch + chunk + second_size);
+      LimbArithmetic::Add(out + offset, out + offset, first_size + second_size - offset, product,
+                          chunk + second_size);
+    }
+  }
 
-  std::strong_ordering Comparison(const BigInteger& other) const {
-    if (nums_.size() < other.nums_.size()) {
-      return std::strong_ordering::less;
+  void Karatsuba(Limb* out, const Limb* first, size_t first_size, const Limb* second, size_t second_size,
+                        Limb* scratch) {
+    size_t half = (first_size + 1) / 2;
+    if (second_size <= half) {
+      MultiplyUnbalanced(out, first, first_size, second, second_size, scratch);
+      return;
     }
-    if (nums_.size() > other.nums_.size()) {
-      return std::strong_ordering::greater;
+    size_t total = first_size + second_size;
+    Limb* first_sum = scratch;
+    Limb* second_sum = first_sum + half + 1;
+    Limb* middle = second_sum + half + 1;
+    Limb* next = middle + 2 * half + 2;
+    MultiplyRecursive(out, first, half, second, half, next);
+    MultiplyRecursive(out + 2 * half, first + half, first_size - half, second + half, second_size - half, next);
+    first_sum[half] = LimbArithmetic::Add(first_sum, first, half, first + half, first_size - half);
+    second_sum[half] = LimbArithmetic::Add(second_sum, second, half, second + half, second_size - half);
+    MultiplyRecursive(middle, first_sum, half + 1, second_sum, half + 1, next);
+    LimbArithmetic::Subtract(middle, middle, 2 * half + 2, out, 2 * half);
+    LimbArithmetic::Subtract(middle, middle, 2 * half + 2, out + 2 * half, total - 2 * half);
+    LimbArithmetic::Add(out + half, out + half, total - half, middle,
+                        LimbArithmetic::Normalize(middle, 2 * half + 2));
+  }
+
+  static void Toom3Evaluate(Limb* at_one, Limb* at_minus_one, bool& minus_one_negative, Limb* at_minus_two,
+                            bool& minus_two_negative, const Limb* number, size_t size, size_t part,
+                            Limb* padded) {
+    size_t length = part + 1;
+    Limb* low = padded;
+    Limb* middle = low + length;
+    Limb* high = middle + length;
+    std::fill(padded, padded + 3 * length, 0);
+    std::copy(number, number + part, low);
+    std::copy(number + part, number + 2 * part, middle);
+    std::copy(number + 2 * part, number + size, high);
+    LimbArithmetic::Add(at_one, low, length, high, length);
+    SignedAdd(at_minus_one, minus_one_negative, at_one, false, middle, true, length);
+    LimbArithmetic::Add(at_one, at_one, length, middle, length);
+    SignedAdd(at_minus_two, minus_two_negative, at_minus_one, minus_one_negative, high, false, length);
+    LimbArithmetic::MultiplySmall(at_minus_two, at_minus_two, length, 2);
+    SignedAdd(at_minus_two, minus_two_negative, at_minus_two, minus_two_negative, low, true, length);
+  }
+
+  void Toom3(Limb* out, const Limb* first, size_t first_size, const Limb* second, size_t second_size,
+                    Limb* scratch) {
+    size_t part = (first_size + 2) / 3;
+    size_t length = part + 1;
+    size_t product_length = 2 * length;
+    size_t total = first_size + second_size;
+    Limb* first_one = scratch;
+    Limb* first_minus_one = first_one + length;
+    Limb* first_minus_two = first_minus_one + length;
+    Limb* second_one = first_minus_two + length;
+    Limb* second_minus_one = second_one + length;
+    Limb* second_minus_two = second_minus_one + length;
+    Limb* padded = second_minus_two + length;
+    Limb* at_one = padded + 3 * length;
+    Limb* at_minus_one = at_one + product_length;
+    Limb* at_minus_two = at_minus_one + product_length;
+    Limb* at_zero = at_minus_two + product_length;
+    Limb* at_infinity = at_zero + product_length;
+    Limb* next = at_infinity + product_length;
+
+    bool first_minus_one_negative = false;
+    bool first_minus_two_negative = false;
+    bool second_minus_one_negative = false;
+    bool second_minus_two_negative = false;
+    Toom3Evaluate(first_one, first_minus_one, first_minus_one_negative, first_minus_two, first_minus_two_negative,
+                  first, first_size, part, padded);
+    Toom3Evaluate(second_one, second_minus_one, second_minus_one_negative, second_minus_two,
+                  second_minus_two_negative, second, second_size, part, padded);
+
+    MultiplyRecursive(out, first, part, second, part, next);
+    MultiplyRecursive(out + 4 * part, first + 2 * part, first_size - 2 * part, second + 2 * part,
+                      second_size - 2 * part, next);
+    MultiplyRecursive(at_one, first_one, length, second_one, length, next);
+    MultiplyRecursive(at_minus_one, first_minus_one, length, second_minus_one, length, next);
+    MultiplyRecursive(at_minus_two, first_minus_two, length, second_minus_two, length, next);
+    bool minus_one_negative = first_minus_one_negative != second_minus_one_negative;
+    bool minus_two_negative = first_minus_two_negative != second_minus_two_negative;
+    bool one_negative = false;
+
+    std::fill(at_zero, at_zero + 2 * product_length, 0);
+    std::copy(out, out + 2 * part, at_zero);
+    std::copy(out + 4 * part, out + total, at_infinity);
+
+    Limb* third = at_minus_two;
+    bool third_negative = false;
+    SignedAdd(third, third_negative, at_minus_two, minus_two_negative, at_one, !one_negative, product_length);
+    LimbArithmetic::DivideSmall(third, third, product_length, 3);
+    SignedAdd(at_one, one_negative, at_one, one_negative, at_minus_one, !minus_one_negative, product_length);
+    LimbArithmetic::DivideSmall(at_one, at_one, product_length, 2);
+    Limb* second_coefficient = at_minus_one;
+    bool second_negative = false;
+    SignedAdd(second_coefficient, second_negative, at_minus_one, minus_one_negative, at_zero, true,
+              product_length);
+    SignedAdd(third, third_negative, second_coefficient, second_negative, third, !third_negative, product_length);
+    LimbArithmetic::DivideSmall(third, third, product_length, 2);
+    SignedAdd(third, third_negative, third, third_negative, at_infinity, false, product_length);
+    SignedAdd(third, third_negative, third, third_negative, at_infinity, false, product_length);
+    SignedAdd(second_coefficient, second_negative, second_coefficient, second_negative, at_one, one_negative,
+              product_length);
+    SignedAdd(second_coefficient, second_negative, second_coefficient, second_negative, at_infinity, true,
+              product_length);
+    SignedAdd(at_one, one_negative, at_one, one_negative, third, !third_negative, product_length);
+    assert(!one_negative && !second_negative && !third_negative);
+
+    std::fill(out + 2 * part, out + 4 * part, 0);
+    LimbArithmetic::Add(out + part, out + part, total - part, at_one,
+                        LimbArithmetic::Normalize(at_one, product_length));
+    LimbArithmetic::Add(out + 2 * part, out + 2 * part, total - 2 * part, second_coefficient,
+                        LimbArithmetic::Normalize(second_coefficient, product_length));
+    LimbArithmetic::Add(out + 3 * part, out + 3 * part, total - 3 * part, third,
+                        LimbArithmetic::Normalize(third, product_length));
+  }
+
+  void MultiplyRecursive(Limb* out, const Limb* first, size_t first_size, const Limb* second,
+                                size_t second_size, Limb* scratch) {
+    if (first_size < second_size) {
+      std::swap(first, second);
+      std::swap(first_size, second_size);
     }
-    for (size_t i = nums_.size(); i > 0; --i) {
-      if (nums_[i - 1] > other.nums_[i - 1]) {
-        return std::strong_ordering::greater;
-      }
-      if (nums_[i - 1] < other.nums_[i - 1]) {
-        return std::strong_ordering::less;
+    if (second_size < KaratsubaThreshold()) {
+      LimbArithmetic::MultiplySchoolbook(out, first, first_size, second, second_size);
+    } else if (UseNtt(first_size, second_size)) {
+      if (first == second && first_size == second_size) {
+        ntt_.Square(out, first, first_size);
+      } else {
+        ntt_.Multiply(out, first, first_size, second, second_size);
       }
+    } else if (2 * second_size <= first_size) {
+      MultiplyUnbalanced(out, first, first_size, second, second_size, scratch);
+    } else if (second_size >= Toom3Threshold() && second_size > 2 * ((first_size + 2) / 3)) {
+      Toom3(out, first, first_size, second, second_size, scratch);
+    } else {
+      Karatsuba(out, first, first_size, second, second_size, scratch);
     }
-    return std::strong_ordering::equal;
   }
 
-  std::strong_ordering operator<=>(const BigInteger& other) const {
-    if (sign_ < other.sign_) {
-      return std::strong_ordering::less;
-    }
-    if (sign_ > other.sign_) {
-      return std::strong_ordering::greater;
+  void MultiplySerial(Limb* out, const Limb* first, size_t first_size, const Limb* second, size_t second_size) {
+    size_t needed = ScratchSize(std::max(first_size, second_size));
+    if (scratch_.size() < needed) {
+      scratch_.resize(needed);
     }
-    if (sign_ == zero) {
-      return std::strong_ordering::equal;
+    MultiplyRecursive(out, first, first_size, second, second_size, scratch_.data());
+  }
+
+  static void MultiplyParallel(Limb* out, const Limb* first, size_t first_size, const Limb* second,
+                               size_t second_size) {
+    if (first_size < second_size) {
+      std::swap(first, second);
+      std::swap(first_size, second_size);
     }
-    std::strong_ordering answer = Comparison(other);
-    if (sign_ == plus) {
-      return answer;
+    if (second_size < parallel_threshold_ || busy_threads_.load() + 1 >= thread_cap_) {
+      Instance().MultiplySerial(out, first, first_size, second, second_size);
+      return;
     }
-    if (answer == std::strong_ordering::equal) {
-      return std::strong_ordering::equal;
+    size_t half = (first_size + 1) / 2;
+    if (second_size <= half) {
+      size_t pieces = std::min(thread_cap_, (first_size + second_size - 1) / second_size);
+      size_t piece = (first_size + pieces - 1) / pieces;
+      std::vector<std::vector<Limb>> products(pieces);
+      std::vector<std::future<void>> tasks;
+      for (size_t i = 0; i * piece < first_size; ++i) {
+        size_t size = std::min(piece, first_size - i * piece);
+        products[i].resize(size + second_size);
+        if (i != 0) {
+          tasks.push_back(Launch([&products, i, first, piece, size, second, second_size] {
+            Instance().MultiplySerial(products[i].data(), first + i * piece, size, second, second_size);
+          }));
+        }
+      }
+      Instance().MultiplySerial(products[0].data(), first, std::min(piece, first_size), second, second_size);
+      for (std::future<void>& task : tasks) {
+        task.get();
+      }
+      std::fill(out, out + first_size + second_size, 0);
+      for (size_t i = 0; i < products.size() && i * piece < first_size; ++i) {
+        LimbArithmetic::Add(out + i * piece, out + i * piece, first_size + second_size - i * piece,
+                            products[i].data(), products[i].size());
+      }
+      return;
     }
-    if (answer == std::strong_ordering::less) {
-      return std::strong_ordering::greater;
+    bool square = first == second && first_size == second_size;
+    size_t first_high = first_size - half;
+    size_t second_high = second_size - half;
+    std::vector<Limb> first_sum(half + 1);
+    first_sum[half] = LimbArithmetic::Add(first_sum.data(), first, half, first + half, first_high);
+    std::vector<Limb> second_sum;
+    if (!square) {
+      second_sum.resize(half + 1);
+      second_sum[half] = LimbArithmetic::Add(second_sum.data(), second, half, second + half, second_high);
     }
-    return std::strong_ordering::less;
+    const Limb* second_sum_data = square ? first_sum.data() : second_sum.data();
+    std::vector<Limb> middle(2 * half + 2);
+    std::future<void> low = Launch([=] {
+      MultiplyParallel(out, first, half, second, half);
+    });
+    std::future<void> high = Launch([=] {
+      MultiplyParallel(out + 2 * half, first + half, first_high, second + half, second_high);
+    });
+    MultiplyParallel(middle.data(), first_sum.data(), half + 1, second_sum_data, half + 1);
+    low.get();
+    high.get();
+    size_t total = first_size + second_size;
+    LimbArithmetic::Subtract(middle.data(), middle.data(), middle.size(), out, 2 * half);
+    LimbArithmetic::Subtract(middle.data(), middle.data(), middle.size(), out + 2 * half, total - 2 * half);
+    LimbArithmetic::Add(out + half, out + half, total - half, middle.data(),
+                        LimbArithmetic::Normalize(middle.data(), middle.size()));
   }
 
-  std::string toString() const {
-    std::string ans;
-    if (sign_ == minus) {
-      ans += "-";
-    }
-    std::string temp = std::to_string(nums_[nums_.size() - 1]);
-    ans += temp;
-    if (nums_.size() >= 2) {
-      for (size_t i = nums_.size() - 1; i > 0; --i) {
-        temp = std::to_string(nums_[i - 1]);
-        std::string nulls(static_cast<size_t>(log10(ns_)) - temp.size(), '0');
-        ans += nulls;
-        ans += temp;
+  static inline std::atomic<size_t> busy_threads_ = 0;
+
+public:
+  static inline size_t karatsuba_threshold_ = 32;
+  static inline size_t toom3_threshold_ = 160;
+  static inline size_t ntt_threshold_ = 6000;
+  static inline size_t parallel_threshold_ = 20000;
+  static inline size_t thread_cap_ = std::max(1u, std::thread::hardware_concurrency());
+
+  static Multiplier& Instance() {
+    thread_local Multiplier multiplier;
+    return multiplier;
+  }
+
+  template <typename Task>
+  static std::future<void> Launch(Task task) {
+    size_t busy = busy_threads_.load();
+    while (busy + 1 < thread_cap_) {
+      if (busy_threads_.compare_exchange_weak(busy, busy + 1)) {
+        return std::async(std::launch::async, [task = std::move(task)] {
+          struct Release {
+            ~Release() {
+              busy_threads_.fetch_sub(1);
+            }
+          } release;
+          task();
+        });
       }
     }
-    return ans;
+    return std::async(std::launch::deferred, std::move(task));
   }
 
-  explicit operator bool() const {
-    return sign_ != zero;
+  void Multiply(Limb* out, const Limb* first, size_t first_size, const Limb* second, size_t second_size) {
+    if (thread_cap_ > 1 && std::min(first_size, second_size) >= parallel_threshold_) {
+      MultiplyParallel(out, first, first_size, second, second_size);
+      return;
+    }
+    MultiplySerial(out, first, first_size, second, second_size);
   }
 
-  BigInteger Abs() const {
-    BigInteger ans = *this;
-    if (ans.sign_ == minus) {
-      ans.sign_ = plus;
-    }
-    return ans;
+  void Square(Limb* out, const Limb* first, size_t size) {
+    Multiply(out, first, size, first, size);
   }
+};
 
-  friend std::istream& operator>>(std::istream& in, BigInteger& other);
+class LimbStorage {
+private:
+  using Limb = LimbArithmetic::Limb;
 
-  void Swap(BigInteger& other) {
-    std::swap(sign_, other.sign_);
-    std::swap(nums_, other.nums_);
+  static constexpr size_t kInlineLimbs = 2;
+
+  size_t size_ = 0;
+  size_t capacity_ = kInlineLimbs;
+  union {
+    Limb inline_[kInlineLimbs];
+    Limb* heap_;
+  };
+
+  bool IsInline() const {
+    return capacity_ == kInlineLimbs;
   }
-};
 
-int Atoi(std::string& str) {
-  int ans = 0;
-  int deg = 1;
-  for (size_t i = str.size(); i > 0; --i) {
-    ans += deg * (str[i - 1] - '0');
-    deg *= 10;
+  void Release() {
+    if (!IsInline()) {
+      delete[] heap_;
+    }
   }
-  return ans;
-}
 
-std::istream& operator>>(std::istream& in, BigInteger& other) {
-  other.nums_.clear();
-  std::string str;
-  in >> str;
-  size_t len = str.size();
-  if (str[0] == '-') {
-    other.sign_ = minus;
-    --len;
-  } else {
-    other.sign_ = plus;
+  void Reserve(size_t limbs) {
+    if (limbs <= capacity_) {
+      return;
+    }
+    size_t capacity = std::max(limbs, 2 * capacity_);
+    Limb* memory = new Limb[capacity];
+    std::copy(data(), data() + size_, memory);
+    Release();
+    heap_ = memory;
+    capacity_ = capacity;
   }
-  if (str[0] == '0') {
-    other = 0;
-    return in;
+
+  void StealFrom(LimbStorage& other) {
+    if (other.IsInline()) {
+      std::copy(other.inline_, other.inline_ + other.size_, inline_);
+    } else {
+      heap_ = other.heap_;
+    }
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.size_ = 0;
+    other.capacity_ = kInlineLimbs;
   }
-  size_t sz = static_cast<size_t>(log10(other.ns_));
-  size_t index = -1;
-  for (size_t i = str.size(); i >= str.size() - len + sz; i -= sz) {
-    index = i - sz;
-    std::string temp = str.substr(i - sz, sz);
-    other.nums_.push_back(Atoi(temp));
+
+public:
+  LimbStorage() {}
+
+  explicit LimbStorage(size_t size, Limb value = 0) {
+    assign(size, value);
   }
-  if (index != 0) {
-    std::string temp = str.substr(str.size() - len, index - (str.size() - len));
-    other.nums_.push_back(Atoi(temp));
+
+  LimbStorage(const LimbStorage& other) {
+    assign(other.begin(), other.end());
   }
-  return in;
-}
 
-std::ostream& operator<<(std::ostream& out, const BigInteger& other) {
-  out << other.toString();
-  return out;
+  LimbStorage(LimbStorage&& other) noexcept {
+    StealFrom(other);
+  }
+
+  LimbStorage& operator=(const LimbStorage& other) {
+    if (this != &other) {
+      assign(other.begin(), other.end());
+    }
+    return *this;
+  }
+
+  LimbStorage& operator=(LimbStorage&& other) noexcept {
+    if (this != &other) {
+      Release();
+      StealFrom(other);
+    }
+    return *this;
+  }
+
+  ~LimbStorage() {
+    Release();
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  Limb* data() {
+    return IsInline() ? inline_ : heap_;
+  }
+
+  const Limb* data() const {
+    return IsInline() ? inline_ : heap_;
+  }
+
+  Limb* begin() {
+    return data();
+  }
+
+  Limb* end() {
+    return data() + size_;
+  }
+
+  const Limb* begin() const {
+    return data();
+  }
+
+  const Limb* end() const {
+    return data() + size_;
+  }
+
+  Limb& operator[](size_t index) {
+    return data()[index];
+  }
+
+  const Limb& operator[](size_t index) const {
+    return data()[index];
+  }
+
+  Limb& back() {
+    return data()[size_ - 1];
+  }
+
+  const Limb& back() const {
+    return data()[size_ - 1];
+  }
+
+  void push_back(Limb value) {
+    Reserve(size_ + 1);
+    data()[size_++] = value;
+  }
+
+  void pop_back() {
+    --size_;
+  }
+
+  void resize(size_t size, Limb value = 0) {
+    Reserve(size);
+    if (size > size_) {
+      std::fill(data() + size_, data() + size, value);
+    }
+    size_ = size;
+  }
+
+  void assign(size_t size, Limb value) {
+    size_ = 0;
+    resize(size, value);
+  }
+
+  void assign(const Limb* first, const Limb* last) {
+    size_t size = static_cast<size_t>(last - first);
+    size_ = 0;
+    Reserve(size);
+    std::copy(first, last, data());
+    size_ = size;
+  }
+
+  void insert(Limb* position, size_t count, Limb value) {
+    size_t offset = static_cast<size_t>(position - data());
+    Reserve(size_ + count);
+    Limb* limbs = data();
+    std::copy_backward(limbs + offset, limbs + size_, limbs + size_ + count);
+    std::fill(limbs + offset, limbs + offset + count, value);
+    size_ += count;
+  }
+
+  void swap(LimbStorage& other) {
+    LimbStorage temp = std::move(other);
+    other = std::move(*this);
+    *this = std::move(temp);
+  }
+};
+
+class ProductExpression;
+
+class LinearExpression;
+
+class BigInteger {
+private:
+  void DeleteExtraZeros() {
+    size_t length = nums_.size();
+    for (size_t i = length; i > 0; --i) {
+      if (nums_[i - 1] != 0) {
+        return;
+      }
+      nums_.pop_back();
+    }
+    *this = 0;
+  }
+
+  void AddSigned(const BigInteger& other, Sign other_sign) {
+    if (other_sign == zero) {
+      return;
+    }
+    if (sign_ == zero) {
+      nums_ = other.nums_;
+      sign_ = other_sign;
+      return;
+    }
+    size_t size = nums_.size();
+    size_t other_size = other.nums_.size();
+    if (sign_ == other_sign) {
+      if (size >= other_size) {
+        Limb carry = LimbArithmetic::Add(nums_.data(), nums_.data(), other_size, other.nums_.data(), other_size);
+        for (size_t i = other_size; carry != 0 && i < size; ++i) {
+          carry = ++nums_[i] == 0;
+        }
+        if (carry != 0) {
+          nums_.push_back(carry);
+        }
+        return;
+      }
+      size_t length = std::max(size, other_size);
+      nums_.resize(length + 1);
+      nums_[length] = LimbArithmetic::Add(nums_.data(), nums_.data(), length, other.nums_.data(), other_size);
+      if (nums_[length] == 0) {
+        nums_.pop_back();
+      }
+      return;
+    }
+    int comparison = LimbArithmetic::Compare(nums_.data(), size, other.nums_.data(), other_size);
+    if (comparison == 0) {
+      nums_.assign(1, 0);
+      sign_ = zero;
+      return;
+    }
+    if (comparison > 0) {
+      Limb borrow = LimbArithmetic::Subtract(nums_.data(), nums_.data(), other_size, other.nums_.data(), other_size);
+      for (size_t i = other_size; borrow != 0 && i < size; ++i) {
+        borrow = nums_[i]-- == 0;
+      }
+    } else {
+      nums_.resize(other_size);
+      LimbArithmetic::Subtract(nums_.data(), other.nums_.data(), other_size, nums_.data(), size);
+      sign_ = other_sign;
+    }
+    nums_.resize(LimbArithmetic::Normalize(nums_.data(), nums_.size()));
+  }
+
+  template <typename Operation>
+  void Bitwise(const BigInteger& other, Operation operation) {
+    size_t size = nums_.size();
+    size_t other_size = other.nums_.size();
+    size_t length = std::max(size, other_size) + 1;
+    bool negative = sign_ == minus;
+    bool other_negative = other.sign_ == minus;
+    bool result_negative = operation(negative ? ~Limb(0) : 0, other_negative ? ~Limb(0) : 0) != 0;
+    Limb carry = negative;
+    Limb other_carry = other_negative;
+    Limb result_carry = result_negative;
+    nums_.resize(length, 0);
+    for (size_t i = 0; i < length; ++i) {
+      Limb mine = i < size ? nums_[i] : 0;
+      Limb theirs = i < other_size ? other.nums_[i] : 0;
+      if (negative) {
+        mine = ~mine + carry;
+        carry &= mine == 0;
+      }
+      if (other_negative) {
+        theirs = ~theirs + other_carry;
+        other_carry &= theirs == 0;
+      }
+      Limb value = operation(mine, theirs);
+      if (result_negative) {
+        value = ~value + result_carry;
+        result_carry &= value == 0;
+      }
+      nums_[i] = value;
+    }
+    size_t result_size = LimbArithmetic::Normalize(nums_.data(), length);
+    if (result_size == 0) {
+      nums_.assign(1, 0);
+      sign_ = zero;
+      return;
+    }
+    nums_.resize(result_size);
+    sign_ = result_negative ? minus : plus;
+  }
+
+  void Step(Sign direction) {
+    if (sign_ == zero) {
+      nums_[0] = 1;
+      sign_ = direction;
+      return;
+    }
+    if (sign_ == direction) {
+      for (size_t i = 0; i < nums_.size(); ++i) {
+        if (++nums_[i] != 0) {
+          return;
+        }
+      }
+      nums_.push_back(1);
+      return;
+    }
+    for (size_t i = 0; nums_[i]-- == 0; ++i) {
+    }
+    if (nums_.back() == 0) {
+      if (nums_.size() == 1) {
+        sign_ = zero;
+      } else {
+        nums_.pop_back();
+      }
+    }
+  }
+
+public:
+  using Limb = LimbArithmetic::Limb;
+
+  Sign sign_;
+  LimbStorage nums_;
+
+  BigInteger() : BigInteger(0) {}
+
+  BigInteger(const ProductExpression& product);
+
+  BigInteger(const LinearExpression& expression);
+
+  BigInteger(int other) : BigInteger(static_cast<int64_t>(other)) {}
+
+  explicit BigInteger(int64_t other) {
+    if (other == 0) {
+      sign_ = zero;
+      nums_.push_back(0);
+    } else if (other > 0) {
+      sign_ = plus;
+      nums_.push_back(static_cast<Limb>(other));
+    } else {
+      sign_ = minus;
+      nums_.push_back(0 - static_cast<Limb>(other));
+    }
+  }
+
+  explicit BigInteger(unsigned long long other) {
+    if (other == 0) {
+      sign_ = zero;
+      nums_.push_back(0);
+    } else {
+      sign_ = plus;
+      nums_.push_back(other);
+    }
+  }
+
+  BigInteger& operator+=(const BigInteger& other) {
+    AddSigned(other, other.sign_);
+    return *this;
+  }
+
+  BigInteger& operator-=(const BigInteger& other) {
+    AddSigned(other, static_cast<Sign>(-other.sign_));
+    return *this;
+  }
+
+  BigInteger& operator<<=(size_t bits) {
+    if (sign_ == zero) {
+      return *this;
+    }
+    size_t size = nums_.size();
+    size_t limbs = bits / LimbArithmetic::kLimbBits;
+    nums_.resize(size + limbs + 1, 0);
+    nums_[size + limbs] = LimbArithmetic::ShiftLeft(nums_.data() + limbs, nums_.data(), size,
+                                                    static_cast<int>(bits % LimbArithmetic::kLimbBits));
+    std::fill(nums_.begin(), nums_.begin() + limbs, 0);
+    if (nums_.back() == 0) {
+      nums_.pop_back();
+    }
+    return *this;
+  }
+
+  BigInteger& operator>>=(size_t bits) {
+    if (sign_ == zero) {
+      return *this;
+    }
+    size_t limbs = bits / LimbArithmetic::kLimbBits;
+    int shift = static_cast<int>(bits % LimbArithmetic::kLimbBits);
+    bool inexact = false;
+    for (size_t i = 0; i < std::min(limbs, nums_.size()) && !inexact; ++i) {
+      inexact = nums_[i] != 0;
+    }
+    if (limbs >= nums_.size()) {
+      *this = sign_ == minus ? -1 : 0;
+      return *this;
+    }
+    inexact |= shift != 0 && (nums_[limbs] << (LimbArithmetic::kLimbBits - shift)) != 0;
+    size_t size = nums_.size() - limbs;
+    LimbArithmetic::ShiftRight(nums_.data(), nums_.data() + limbs, size, shift);
+    nums_.resize(size);
+    if (nums_.back() == 0) {
+      nums_.pop_back();
+    }
+    if (nums_.size() == 0) {
+      nums_.push_back(0);
+      sign_ = sign_ == minus ? minus : zero;
+    }
+    if (sign_ == minus && inexact) {
+      Step(minus);
+    }
+    return *this;
+  }
+
+  BigInteger& operator&=(const BigInteger& other) {
+    Bitwise(other, [](Limb first, Limb second) { return first & second; });
+    return *this;
+  }
+
+  BigInteger& operator|=(const BigInteger& other) {
+    Bitwise(other, [](Limb first, Limb second) { return first | second; });
+    return *this;
+  }
+
+  BigInteger& operator^=(const BigInteger& other) {
+    Bitwise(other, [](Limb first, Limb second) { return first ^ second; });
+    return *this;
+  }
+
+  BigInteger operator~() const {
+    BigInteger answer = -*this;
+    answer.Step(minus);
+    return answer;
+  }
+
+  size_t bit_length() const {
+    if (sign_ == zero) {
+      return 0;
+    }
+    return nums_.size() * LimbArithmetic::kLimbBits - static_cast<size_t>(__builtin_clzll(nums_.back()));
+  }
+
+  size_t popcount() const {
+    size_t answer = 0;
+    for (Limb limb : nums_) {
+      answer += static_cast<size_t>(__builtin_popcountll(limb));
+    }
+    return answer;
+  }
+
+  bool test_bit(size_t bit) const {
+    size_t limb = bit / LimbArithmetic::kLimbBits;
+    Limb mask = Limb(1) << (bit % LimbArithmetic::kLimbBits);
+    if (limb >= nums_.size()) {
+      return sign_ == minus;
+    }
+    bool set = (nums_[limb] & mask) != 0;
+    if (sign_ != minus) {
+      return set;
+    }
+    bool lower_zero = (nums_[limb] & (mask - 1)) == 0;
+    for (size_t i = 0; i < limb && lower_zero; ++i) {
+      lower_zero = nums_[i] == 0;
+    }
+    return set == lower_zero;
+  }
+
+  BigInteger& operator*=(const BigInteger& other);
+
+  BigInteger& operator=(const ProductExpression& product);
+
+  BigInteger& operator=(const LinearExpression& expression);
+
+  BigInteger& operator+=(const ProductExpression& product);
+
+  BigInteger& operator-=(const ProductExpression& product);
+
+  BigInteger& add_product(const BigInteger& first, const BigInteger& second);
+
+  BigInteger& operator/=(const BigInteger&);
+
+  BigInteger& operator%=(const BigInteger&);
+
+  BigInteger operator-() const {
+    BigInteger answer = *this;
+    if (sign_ == plus) {
+      answer.sign_ = minus;
+    }
+    if (sign_ == minus) {
+      answer.sign_ = plus;
+    }
+    return answer;
+  }
+
+  BigInteger& operator++() {
+    Step(plus);
+    return *this;
+  }
+
+  BigInteger operator++(int) {
+    BigInteger copy = *this;
+    Step(plus);
+    return copy;
+  }
+
+  BigInteger& operator--() {
+    Step(minus);
+    return *this;
+  }
+
+  BigInteger operator--(int) {
+    BigInteger copy = *this;
+    Step(minus);
+    return copy;
+  }
+
+  bool operator==(const BigInteger& other) const {
+    if (sign_ != other.sign_ || nums_.size() != other.nums_.size()) {
+      return false;
+    }
+    for (size_t i = nums_.size(); i >= 1; --i) {
+      if (nums_[i - 1] != other.nums_[i - 1]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(const BigInteger& other) const { return !(*this == other); }
+
+  std::strong_ordering Comparison(const BigInteger& other) const {
+    if (nums_.size() < other.nums_.size()) {
+      return std::strong_ordering::less;
+    }
+    if (nums_.size() > other.nums_.size()) {
+      return std::strong_ordering::greater;
+    }
+    for (size_t i = nums_.size(); i > 0; --i) {
+      if (nums_[i - 1] > other.nums_[i - 1]) {
+        return std::strong_ordering::greater;
+      }
+      if (nums_[i - 1] < other.nums_[i - 1]) {
+        return std::strong_ordering::less;
+      }
+    }
+    return std::strong_ordering::equal;
+  }
+
+  std::strong_ordering operator<=>(const BigInteger& other) const {
+    if (sign_ < other.sign_) {
+      return std::strong_ordering::less;
+    }
+    if (sign_ > other.sign_) {
+      return std::strong_ordering::greater;
+    }
+    if (sign_ == zero) {
+      return std::strong_ordering::equal;
+    }
+    std::strong_ordering answer = Comparison(other);
+    if (sign_ == plus) {
+      return answer;
+    }
+    if (answer == std::strong_ordering::equal) {
+      return std::strong_ordering::equal;
+    }
+    if (answer == std::strong_ordering::less) {
+      return std::strong_ordering::greater;
+    }
+    return std::strong_ordering::less;
+  }
+
+  std::string toString() const;
+
+  explicit operator bool() const {
+    return sign_ != zero;
+  }
+
+  BigInteger Abs() const {
+    BigInteger ans = *this;
+    if (ans.sign_ == minus) {
+      ans.sign_ = plus;
+    }
+    return ans;
+  }
+
+  friend std::istream& operator>>(std::istream& in, BigInteger& other);
+
+  friend class Divider;
+
+  friend class DecimalConverter;
+
+  friend class GcdEngine;
+
+  void Swap(BigInteger& other) {
+    std::swap(sign_, other.sign_);
+    nums_.swap(other.nums_);
+  }
+};
+
+std::ostream& operator<<(std::ostream& out, const BigInteger& other) {
+  out << other.toString();
+  return out;
+}
+
+BigInteger operator""_bi(unsigned long long number) {
+  BigInteger ans(number);
+  return ans;
+}
+
+void swap(BigInteger& first, BigInteger& second) {
+  first.Swap(second);
+}
+
+BigInteger operator<<(const BigInteger& number, size_t bits) {
+  BigInteger answer = number;
+  answer <<= bits;
+  return answer;
+}
+
+BigInteger operator>>(const BigInteger& number, size_t bits) {
+  BigInteger answer = number;
+  answer >>= bits;
+  return answer;
+}
+
+BigInteger operator&(const BigInteger& first, const BigInteger& second) {
+  BigInteger answer = first;
+  answer &= second;
+  return answer;
+}
+
+BigInteger operator|(const BigInteger& first, const BigInteger& second) {
+  BigInteger answer = first;
+  answer |= second;
+  return answer;
+}
+
+BigInteger operator^(const BigInteger& first, const BigInteger& second) {
+  BigInteger answer = first;
+  answer ^= second;
+  return answer;
+}
+
+BigInteger operator+(const BigInteger& first, const BigInteger& other) {
+  BigInteger temp = first;
+  temp += other;
+  return temp;
+}
+
+BigInteger operator-(const BigInteger& first, const BigInteger& other) {
+  BigInteger temp = first;
+  temp -= other;
+  return temp;
+}
+
+class ProductExpression {
+public:
+  const BigInteger& first_;
+  const BigInteger& second_;
+
+  ProductExpression(const BigInteger& first, const BigInteger& second) : first_(first), second_(second) {}
+
+  Sign ResultSign() const {
+    return static_cast<Sign>(first_.sign_ * second_.sign_);
+  }
+};
+
+class LinearExpression {
+public:
+  ProductExpression first_;
+  ProductExpression second_;
+  bool subtract_;
+
+  LinearExpression(const ProductExpression& first, const ProductExpression& second, bool subtract)
+      : first_(first), second_(second), subtract_(subtract) {}
+};
+
+class ExpressionEvaluator {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  BigInteger addend_;
+  BigInteger other_addend_;
+  LimbStorage product_;
+
+public:
+  static ExpressionEvaluator& Instance() {
+    thread_local ExpressionEvaluator evaluator;
+    return evaluator;
+  }
+
+  void Multiply(BigInteger& out, const BigInteger& first, const BigInteger& second) {
+    if (first.sign_ == zero || second.sign_ == zero) {
+      out = 0;
+      return;
+    }
+    Sign sign = static_cast<Sign>(first.sign_ * second.sign_);
+    bool aliased = &out == &first || &out == &second;
+    LimbStorage& target = aliased ? product_ : out.nums_;
+    target.resize(first.nums_.size() + second.nums_.size());
+    if (&first == &second) {
+      Multiplier::Instance().Square(target.data(), first.nums_.data(), first.nums_.size());
+    } else {
+      Multiplier::Instance().Multiply(target.data(), first.nums_.data(), first.nums_.size(), second.nums_.data(),
+                                      second.nums_.size());
+    }
+    if (aliased) {
+      out.nums_.swap(product_);
+    }
+    if (out.nums_.back() == 0) {
+      out.nums_.pop_back();
+    }
+    out.sign_ = sign;
+  }
+
+  void MultiplyAdd(BigInteger& out, const ProductExpression& product, bool subtract) {
+    Sign sign = product.ResultSign();
+    if (sign == zero) {
+      return;
+    }
+    if (subtract) {
+      sign = static_cast<Sign>(-sign);
+    }
+    const BigInteger& longer = product.first_.nums_.size() >= product.second_.nums_.size() ? product.first_
+                                                                                            : product.second_;
+    const BigInteger& shorter = &longer == &product.first_ ? product.second_ : product.first_;
+    size_t size = longer.nums_.size() + shorter.nums_.size();
+    bool aliased = &out == &longer || &out == &shorter;
+    bool dominated = out.sign_ != zero && out.sign_ != sign && out.nums_.size() <= size;
+    if (aliased || dominated || shorter.nums_.size() >= Multiplier::karatsuba_threshold_) {
+      Multiply(addend_, longer, shorter);
+      addend_.sign_ = sign;
+      out += addend_;
+      return;
+    }
+    if (out.sign_ == zero) {
+      out.nums_.assign(size + 1, 0);
+      out.sign_ = sign;
+    } else {
+      out.nums_.resize(std::max(out.nums_.size(), size) + 1);
+    }
+    Limb* window = out.nums_.data();
+    const Limb* first = longer.nums_.data();
+    const Limb* second = shorter.nums_.data();
+    size_t first_size = longer.nums_.size();
+    size_t second_size = shorter.nums_.size();
+    if (out.sign_ == sign) {
+      for (size_t i = 0; i < second_size; ++i) {
+        Limb carry = LimbArithmetic::AddMultiple(window + i, first, first_size, second[i]);
+        for (size_t position = i + first_size; carry != 0; ++position) {
+          window[position] += carry;
+          carry = window[position] < carry ? 1 : 0;
+        }
+      }
+    } else {
+      for (size_t i = 0; i < second_size; ++i) {
+        bool borrow = LimbArithmetic::SubtractMultiple(window + i, first, first_size, second[i]);
+        for (size_t position = i + first_size + 1; borrow; ++position) {
+          borrow = window[position] == 0;
+          --window[position];
+        }
+      }
+    }
+    while (out.nums_.back() == 0) {
+      out.nums_.pop_back();
+    }
+  }
+
+  void Evaluate(BigInteger& out, const LinearExpression& expression) {
+    const ProductExpression& second = expression.second_;
+    if (&out == &second.first_ || &out == &second.second_) {
+      Multiply(addend_, second.first_, second.second_);
+      if (expression.subtract_) {
+        addend_.sign_ = static_cast<Sign>(-addend_.sign_);
+      }
+      Multiply(out, expression.first_.first_, expression.first_.second_);
+      out += addend_;
+      return;
+    }
+    Multiply(out, expression.first_.first_, expression.first_.second_);
+    MultiplyAdd(out, second, expression.subtract_);
+  }
+
+  std::strong_ordering Compare(const ProductExpression& first, const ProductExpression& second) {
+    Sign first_sign = first.ResultSign();
+    Sign second_sign = second.ResultSign();
+    if (first_sign != second_sign || first_sign == zero) {
+      return first_sign <=> second_sign;
+    }
+    size_t first_size = first.first_.nums_.size() + first.second_.nums_.size();
+    size_t second_size = second.first_.nums_.size() + second.second_.nums_.size();
+    if (first_size + 1 < second_size || second_size + 1 < first_size) {
+      return first_sign == plus ? first_size <=> second_size : second_size <=> first_size;
+    }
+    Multiply(addend_, first.first_, first.second_);
+    Multiply(other_addend_, second.first_, second.second_);
+    return addend_ <=> other_addend_;
+  }
+};
+
+BigInteger::BigInteger(const ProductExpression& product) : BigInteger() {
+  ExpressionEvaluator::Instance().Multiply(*this, product.first_, product.second_);
+}
+
+BigInteger::BigInteger(const LinearExpression& expression) : BigInteger() {
+  ExpressionEvaluator::Instance().Evaluate(*this, expression);
+}
+
+BigInteger& BigInteger::operator*=(const BigInteger& other) {
+  ExpressionEvaluator::Instance().Multiply(*this, *this, other);
+  return *this;
+}
+
+BigInteger& BigInteger::operator=(const ProductExpression& product) {
+  ExpressionEvaluator::Instance().Multiply(*this, product.first_, product.second_);
+  return *this;
+}
+
+BigInteger& BigInteger::operator=(const LinearExpression& expression) {
+  ExpressionEvaluator::Instance().Evaluate(*this, expression);
+  return *this;
+}
+
+BigInteger& BigInteger::operator+=(const ProductExpression& product) {
+  ExpressionEvaluator::Instance().MultiplyAdd(*this, product, false);
+  return *this;
+}
+
+BigInteger& BigInteger::operator-=(const ProductExpression& product) {
+  ExpressionEvaluator::Instance().MultiplyAdd(*this, product, true);
+  return *this;
+}
+
+BigInteger& BigInteger::add_product(const BigInteger& first, const BigInteger& second) {
+  ExpressionEvaluator::Instance().MultiplyAdd(*this, ProductExpression(first, second), false);
+  return *this;
+}
+
+BigInteger operator*(const BigInteger& first, const BigInteger& other) {
+  BigInteger answer;
+  ExpressionEvaluator::Instance().Multiply(answer, first, other);
+  return answer;
+}
+
+BigInteger operator*(BigInteger&& first, const BigInteger& other) {
+  first *= other;
+  return std::move(first);
+}
+
+BigInteger operator*(const BigInteger& first, BigInteger&& other) {
+  other *= first;
+  return std::move(other);
+}
+
+BigInteger operator*(BigInteger&& first, BigInteger&& other) {
+  first *= other;
+  return std::move(first);
+}
+
+BigInteger operator-(const ProductExpression& product) {
+  BigInteger answer = product;
+  answer.sign_ = static_cast<Sign>(-answer.sign_);
+  return answer;
+}
+
+LinearExpression operator+(const ProductExpression& first, const ProductExpression& second) {
+  return LinearExpression(first, second, false);
+}
+
+LinearExpression operator-(const ProductExpression& first, const ProductExpression& second) {
+  return LinearExpression(first, second, true);
+}
+
+BigInteger operator+(const BigInteger& first, const ProductExpression& product) {
+  BigInteger temp = first;
+  temp += product;
+  return temp;
+}
+
+BigInteger operator-(const BigInteger& first, const ProductExpression& product) {
+  BigInteger temp = first;
+  temp -= product;
+  return temp;
+}
+
+std::strong_ordering operator<=>(const ProductExpression& first, const ProductExpression& second) {
+  return ExpressionEvaluator::Instance().Compare(first, second);
+}
+
+bool operator==(const ProductExpression& first, const ProductExpression& second) {
+  return ExpressionEvaluator::Instance().Compare(first, second) == std::strong_ordering::equal;
+}
+
+class Divider {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  std::vector<Limb> scratch_;
+  std::vector<Limb> quotient_;
+  std::vector<Limb> remainder_;
+
+  static BigInteger ShiftRight(const BigInteger& number, size_t limbs) {
+    if (limbs >= number.nums_.size()) {
+      return 0;
+    }
+    BigInteger answer;
+    answer.sign_ = plus;
+    answer.nums_.assign(number.nums_.begin() + static_cast<ptrdiff_t>(limbs), number.nums_.end());
+    return answer;
+  }
+
+  static BigInteger ShiftLeft(const BigInteger& number, size_t limbs) {
+    if (number.sign_ == zero) {
+      return number;
+    }
+    BigInteger answer = number;
+    answer.nums_.insert(answer.nums_.begin(), limbs, 0);
+    return answer;
+  }
+
+  static void Correct(BigInteger& quotient, BigInteger& remainder, const BigInteger& divisor) {
+    while (remainder.sign_ == minus) {
+      --quotient;
+      remainder += divisor;
+    }
+    while (remainder >= divisor) {
+      ++quotient;
+      remainder -= divisor;
+    }
+  }
+
+  BigInteger Reciprocal(const BigInteger& divisor) {
+    size_t length = divisor.nums_.size();
+    BigInteger power = ShiftLeft(1, 2 * length);
+    if (length <= kReciprocalBase) {
+      BigInteger quotient;
+      BigInteger remainder;
+      DivideKnuth(power, divisor, quotient, remainder);
+      return quotient;
+    }
+    size_t half = (length + 1) / 2 + 2;
+    BigInteger top_reciprocal = Reciprocal(ShiftRight(divisor, length - half));
+    BigInteger reciprocal = ShiftLeft(top_reciprocal + top_reciprocal, length - half) -
+                            ShiftRight(divisor * (top_reciprocal * top_reciprocal), 2 * half);
+    BigInteger error = power - ProductExpression(divisor, reciprocal);
+    Correct(reciprocal, error, divisor);
+    return reciprocal;
+  }
+
+  void DivideNewton(const BigInteger& dividend, const BigInteger& divisor, BigInteger& quotient,
+                    BigInteger& remainder) {
+    size_t dividend_size = dividend.nums_.size();
+    size_t divisor_size = divisor.nums_.size();
+    if (dividend_size <= 2 * divisor_size) {
+      size_t length = std::min(divisor_size, dividend_size - divisor_size + 2);
+      size_t shift = divisor_size - length;
+      BigInteger reciprocal = Reciprocal(ShiftRight(divisor, shift));
+      BigInteger result = ShiftRight(ShiftRight(dividend, shift) * reciprocal, 2 * length);
+      BigInteger rest = dividend - ProductExpression(result, divisor);
+      Correct(result, rest, divisor);
+      quotient.Swap(result);
+      remainder.Swap(rest);
+      return;
+    }
+    BigInteger reciprocal = Reciprocal(divisor);
+    LimbStorage result(dividend_size, 0);
+    BigInteger rest = 0;
+    size_t position = (dividend_size - 1) / divisor_size * divisor_size;
+    while (true) {
+      BigInteger block;
+      block.sign_ = plus;
+      block.nums_.assign(dividend.nums_.begin() + static_cast<ptrdiff_t>(position),
+                         dividend.nums_.begin() + static_cast<ptrdiff_t>(
+                             std::min(position + divisor_size, dividend_size)));
+      block.DeleteExtraZeros();
+      block += ShiftLeft(rest, divisor_size);
+      BigInteger digit = ShiftRight(block * reciprocal, 2 * divisor_size);
+      rest = block - ProductExpression(digit, divisor);
+      Correct(digit, rest, divisor);
+      if (digit.sign_ != zero) {
+        std::copy(digit.nums_.begin(), digit.nums_.end(), result.begin() + static_cast<ptrdiff_t>(position));
+      }
+      if (position == 0) {
+        break;
+      }
+      position -= divisor_size;
+    }
+    quotient.nums_.swap(result);
+    quotient.sign_ = plus;
+    quotient.DeleteExtraZeros();
+    remainder.Swap(rest);
+  }
+
+  static void Assign(BigInteger& number, const std::vector<Limb>& limbs) {
+    number.nums_.assign(limbs.data(), limbs.data() + limbs.size());
+    number.sign_ = plus;
+    number.DeleteExtraZeros();
+  }
+
+  void DivideKnuth(const BigInteger& dividend, const BigInteger& divisor, BigInteger& quotient,
+                   BigInteger& remainder) {
+    size_t dividend_size = dividend.nums_.size();
+    size_t divisor_size = divisor.nums_.size();
+    quotient_.resize(dividend_size - divisor_size + 1);
+    remainder_.resize(divisor_size);
+    if (divisor_size == 1) {
+      remainder_[0] = LimbArithmetic::DivideSmall(quotient_.data(), dividend.nums_.data(), dividend_size,
+                                                  divisor.nums_[0]);
+    } else {
+      if (scratch_.size() < dividend_size + divisor_size + 1) {
+        scratch_.resize(dividend_size + divisor_size + 1);
+      }
+      LimbArithmetic::DivideKnuth(quotient_.data(), remainder_.data(), dividend.nums_.data(), dividend_size,
+                                  divisor.nums_.data(), divisor_size, scratch_.data());
+    }
+    Assign(quotient, quotient_);
+    Assign(remainder, remainder_);
+  }
+
+public:
+  static constexpr size_t kReciprocalBase = 16;
+  static inline size_t newton_threshold_ = 800;
+
+  static Divider& Instance() {
+    thread_local Divider divider;
+    return divider;
+  }
+
+  void DivideAbs(const BigInteger& dividend, const BigInteger& divisor, BigInteger& quotient,
+                 BigInteger& remainder) {
+    if (dividend.Comparison(divisor) == std::strong_ordering::less) {
+      remainder = dividend;
+      remainder.sign_ = plus;
+      quotient.nums_.assign(1, 0);
+      quotient.sign_ = zero;
+      return;
+    }
+    size_t divisor_size = divisor.nums_.size();
+    if (divisor_size >= newton_threshold_ && dividend.nums_.size() - divisor_size >= newton_threshold_) {
+      DivideNewton(dividend.Abs(), divisor.Abs(), quotient, remainder);
+      return;
+    }
+    DivideKnuth(dividend, divisor, quotient, remainder);
+  }
+};
+
+void divmod(const BigInteger& dividend, const BigInteger& divisor, BigInteger& quotient, BigInteger& remainder) {
+  if (divisor.sign_ == zero || dividend.sign_ == zero) {
+    quotient = dividend;
+    remainder = dividend;
+    return;
+  }
+  Sign dividend_sign = dividend.sign_;
+  Sign divisor_sign = divisor.sign_;
+  Divider::Instance().DivideAbs(dividend, divisor, quotient, remainder);
+  if (quotient.sign_ != zero && dividend_sign != divisor_sign) {
+    quotient.sign_ = minus;
+  }
+  if (remainder.sign_ != zero) {
+    remainder.sign_ = dividend_sign;
+  }
+}
+
+std::pair<BigInteger, BigInteger> divmod(const BigInteger& dividend, const BigInteger& divisor) {
+  std::pair<BigInteger, BigInteger> answer;
+  divmod(dividend, divisor, answer.first, answer.second);
+  return answer;
+}
+
+BigInteger& BigInteger::operator/=(const BigInteger& other) {
+  thread_local BigInteger remainder;
+  divmod(*this, other, *this, remainder);
+  return *this;
+}
+
+BigInteger operator/(const BigInteger& first, const BigInteger& other) {
+  BigInteger temp = first;
+  temp /= other;
+  return temp;
+}
+
+BigInteger& BigInteger::operator%=(const BigInteger& other) {
+  thread_local BigInteger quotient;
+  divmod(*this, other, quotient, *this);
+  return *this;
+}
+
+BigInteger operator%(const BigInteger& first, const BigInteger& other) {
+  BigInteger temp = first;
+  temp %= other;
+  return temp;
+}
+
+
+class DecimalConverter {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  static constexpr Limb kChunk = 10000000000000000000ull;
+  static constexpr size_t kChunkDigits = 19;
+
+  std::vector<BigInteger> powers_;
+  std::vector<BigInteger> reciprocals_;
+  std::vector<Limb> scratch_;
+
+  const BigInteger& Power(size_t level) {
+    if (powers_.empty()) {
+      powers_.emplace_back(static_cast<unsigned long long>(kChunk));
+    }
+    while (powers_.size() <= level) {
+      BigInteger next = powers_.back();
+      next *= next;
+      powers_.push_back(std::move(next));
+    }
+    return powers_[level];
+  }
+
+  const BigInteger& Reciprocal(size_t level) {
+    while (reciprocals_.size() <= level) {
+      const BigInteger& power = Power(reciprocals_.size());
+      BigInteger numerator;
+      numerator.sign_ = plus;
+      numerator.nums_.assign(2 * power.nums_.size() + 1, 0);
+      numerator.nums_.back() = 1;
+      reciprocals_.push_back(numerator / power);
+    }
+    return reciprocals_[level];
+  }
+
+  void DivideByPower(const BigInteger& number, size_t level, BigInteger& quotient, BigInteger& remainder) {
+    const BigInteger& power = Power(level);
+    size_t shift = 2 * power.nums_.size();
+    BigInteger product = number * Reciprocal(level);
+    quotient.sign_ = plus;
+    if (product.nums_.size() > shift) {
+      quotient.nums_.assign(product.nums_.begin() + static_cast<ptrdiff_t>(shift), product.nums_.end());
+    } else {
+      quotient.nums_.assign(1, 0);
+    }
+    quotient.DeleteExtraZeros();
+    remainder = number - ProductExpression(quotient, power);
+    while (remainder.sign_ == minus) {
+      --quotient;
+      remainder += power;
+    }
+    while (remainder >= power) {
+      ++quotient;
+      remainder -= power;
+    }
+  }
+
+  void WriteBasecase(const BigInteger& number, char* end, size_t width) {
+    scratch_.assign(number.nums_.begin(), number.nums_.end());
+    size_t size = LimbArithmetic::Normalize(scratch_.data(), scratch_.size());
+    char* begin = end - width;
+    char* position = end;
+    while (size > 0) {
+      Limb chunk = LimbArithmetic::DivideSmall(scratch_.data(), scratch_.data(), size, kChunk);
+      size = LimbArithmetic::Normalize(scratch_.data(), size);
+      for (size_t i = 0; i < kChunkDigits && position > begin; ++i) {
+        *--position = static_cast<char>('0' + chunk % 10);
+        chunk /= 10;
+      }
+    }
+    std::fill(begin, position, '0');
+  }
+
+  void WriteDigits(const BigInteger& number, char* end, size_t width) {
+    size_t size = number.nums_.size();
+    if (size <= basecase_limbs_) {
+      WriteBasecase(number, end, width);
+      return;
+    }
+    size_t level = 0;
+    while ((kChunkDigits << (level + 1)) < width) {
+      ++level;
+    }
+    BigInteger quotient;
+    BigInteger remainder;
+    DivideByPower(number, level, quotient, remainder);
+    size_t low_width = kChunkDigits << level;
+    WriteDigits(remainder, end, low_width);
+    WriteDigits(quotient, end - low_width, width - low_width);
+  }
+
+  void ParseBasecase(const char* begin, size_t length, BigInteger& number) {
+    number.nums_.assign(1, 0);
+    number.sign_ = plus;
+    size_t chunk = length % kChunkDigits == 0 ? kChunkDigits : length % kChunkDigits;
+    for (const char* position = begin; position < begin + length; position += chunk, chunk = kChunkDigits) {
+      Limb value = 0;
+      Limb deg = 1;
+      for (size_t i = 0; i < chunk; ++i) {
+        value = value * 10 + static_cast<Limb>(position[i] - '0');
+        deg *= 10;
+      }
+      Limb carry = LimbArithmetic::MultiplySmall(number.nums_.data(), number.nums_.data(), number.nums_.size(), deg);
+      carry += LimbArithmetic::Add(number.nums_.data(), number.nums_.data(), number.nums_.size(), &value, 1);
+      if (carry != 0) {
+        number.nums_.push_back(carry);
+      }
+    }
+    number.DeleteExtraZeros();
+  }
+
+public:
+  static inline size_t basecase_limbs_ = 24;
+
+  static DecimalConverter& Instance() {
+    thread_local DecimalConverter converter;
+    return converter;
+  }
+
+  std::string ToString(const BigInteger& number) {
+    size_t bits = number.nums_.size() * LimbArithmetic::kLimbBits -
+                  static_cast<size_t>(__builtin_clzll(number.nums_.back() | 1));
+    size_t width = bits * 30103 / 100000 + 1;
+    std::string answer(width + 1, '0');
+    WriteDigits(number.Abs(), answer.data() + answer.size(), width);
+    size_t first = std::min(answer.find_first_not_of('0'), answer.size() - 1);
+    if (number.sign_ == minus) {
+      answer[--first] = '-';
+    }
+    answer.erase(0, first);
+    return answer;
+  }
+
+  void Parse(const char* begin, size_t length, BigInteger& number) {
+    if (length <= basecase_limbs_ * kChunkDigits) {
+      ParseBasecase(begin, length, number);
+      return;
+    }
+    size_t level = 0;
+    while ((kChunkDigits << (level + 2)) <= length) {
+      ++level;
+    }
+    size_t low_width = kChunkDigits << level;
+    BigInteger low;
+    Parse(begin, length - low_width, number);
+    Parse(begin + length - low_width, low_width, low);
+    number *= Power(level);
+    number += low;
+  }
+};
+
+std::string BigInteger::toString() const {
+  return DecimalConverter::Instance().ToString(*this);
+}
+
+std::istream& operator>>(std::istream& in, BigInteger& other) {
+  std::string str;
+  in >> str;
+  size_t start = str[0] == '-' ? 1 : 0;
+  DecimalConverter::Instance().Parse(str.data() + start, str.size() - start, other);
+  if (start == 1 && other.sign_ == plus) {
+    other.sign_ = minus;
+  }
+  return in;
+}
+
+class GcdEngine {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  BigInteger first_;
+  BigInteger second_;
+  BigInteger quotient_;
+  LimbStorage next_first_;
+  LimbStorage next_second_;
+
+  static int64_t TopBits(const LimbStorage& number, size_t size, int shift) {
+    Limb high = size - 1 < number.size() ? number[size - 1] : 0;
+    Limb low = size >= 2 && size - 2 < number.size() ? number[size - 2] : 0;
+    Limb bits = shift == 0 ? high : (high << shift) | (low >> (LimbArithmetic::kLimbBits - shift));
+    return static_cast<int64_t>(bits >> 2);
+  }
+
+  void Remainder() {
+    Divider::Instance().DivideAbs(first_, second_, quotient_, first_);
+    first_.Swap(second_);
+  }
+
+  bool LehmerStep() {
+    size_t size = first_.nums_.size();
+    int shift = __builtin_clzll(first_.nums_.back());
+    int64_t x = TopBits(first_.nums_, size, shift);
+    int64_t y = TopBits(second_.nums_, size, shift);
+    int64_t a = 1;
+    int64_t b = 0;
+    int64_t c = 0;
+    int64_t d = 1;
+    while (y + c > 0 && y + d > 0) {
+      int64_t q = (x + a) / (y + c);
+      if (q != (x + b) / (y + d)) {
+        break;
+      }
+      int64_t temp = a - q * c;
+      a = c;
+      c = temp;
+      temp = b - q * d;
+      b = d;
+      d = temp;
+      temp = x - q * y;
+      x = y;
+      y = temp;
+    }
+    if (b == 0) {
+      return false;
+    }
+    second_.nums_.resize(size, 0);
+    next_first_.resize(size);
+    next_second_.resize(size);
+    LimbArithmetic::LinearCombination(next_first_.data(), first_.nums_.data(), second_.nums_.data(), size, a, b);
+    LimbArithmetic::LinearCombination(next_second_.data(), first_.nums_.data(), second_.nums_.data(), size, c, d);
+    first_.nums_.swap(next_first_);
+    second_.nums_.swap(next_second_);
+    first_.DeleteExtraZeros();
+    second_.DeleteExtraZeros();
+    if (first_.Comparison(second_) == std::strong_ordering::less) {
+      first_.Swap(second_);
+    }
+    return true;
+  }
+
+public:
+  static GcdEngine& Instance() {
+    thread_local GcdEngine engine;
+    return engine;
+  }
+
+  void Gcd(const BigInteger& first, const BigInteger& second, BigInteger& answer) {
+    first_ = first;
+    second_ = second;
+    first_.sign_ = first_.sign_ == zero ? zero : plus;
+    second_.sign_ = second_.sign_ == zero ? zero : plus;
+    if (first_.Comparison(second_) == std::strong_ordering::less) {
+      first_.Swap(second_);
+    }
+    while (second_.nums_.size() > 1) {
+      if (first_.nums_.size() - second_.nums_.size() > 1 || !LehmerStep()) {
+        Remainder();
+      }
+    }
+    if (second_.sign_ != zero) {
+      Limb small = second_.nums_[0];
+      Limb rest = LimbArithmetic::DivideSmall(first_.nums_.data(), first_.nums_.data(), first_.nums_.size(), small);
+      while (rest != 0) {
+        Limb temp = small % rest;
+        small = rest;
+        rest = temp;
+      }
+      first_ = BigInteger(static_cast<unsigned long long>(small));
+    }
+    answer = first_;
+  }
+};
+
+BigInteger gcd(const BigInteger& first, const BigInteger& second) {
+  BigInteger answer;
+  GcdEngine::Instance().Gcd(first, second, answer);
+  return answer;
+}
+
+class ModContext {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  BigInteger modulus_;
+  size_t size_;
+  Limb inverse_ = 0;
+  std::vector<Limb> square_;
+  std::vector<Limb> product_;
+  std::vector<Limb> scratch_;
+  std::vector<Limb> table_;
+
+  static size_t WindowBits(size_t exponent_bits) {
+    if (exponent_bits > 671) {
+      return 6;
+    }
+    if (exponent_bits > 239) {
+      return 5;
+    }
+    if (exponent_bits > 79) {
+      return 4;
+    }
+    if (exponent_bits > 23) {
+      return 3;
+    }
+    return 1;
+  }
+
+  bool IsMontgomery() const {
+    return (modulus_.nums_[0] & 1) != 0;
+  }
+
+  void PrepareMontgomery() {
+    if (!square_.empty()) {
+      return;
+    }
+    Limb modulus = modulus_.nums_[0];
+    inverse_ = modulus;
+    for (int i = 0; i < 5; ++i) {
+      inverse_ *= 2 - modulus * inverse_;
+    }
+    inverse_ = 0 - inverse_;
+    square_.assign(size_ + 1, 0);
+    square_[0] = 1;
+    const Limb* limbs = modulus_.nums_.data();
+    for (size_t i = 0; i < 2 * size_ * LimbArithmetic::kLimbBits; ++i) {
+      square_[size_] = LimbArithmetic::Add(square_.data(), square_.data(), size_, square_.data(), size_);
+      if (square_[size_] != 0 || LimbArithmetic::Compare(square_.data(), size_, limbs, size_) >= 0) {
+        LimbArithmetic::Subtract(square_.data(), square_.data(), size_ + 1, limbs, size_);
+      }
+    }
+    square_.resize(size_);
+  }
+
+  void Reduce(Limb* out) {
+    const Limb* limbs = modulus_.nums_.data();
+    if (!IsMontgomery()) {
+      if (size_ == 1) {
+        out[0] = LimbArithmetic::DivideSmall(scratch_.data(), product_.data(), 2, limbs[0]);
+      } else {
+        LimbArithmetic::DivideKnuth(scratch_.data(), out, product_.data(), 2 * size_, limbs, size_,
+                                    scratch_.data() + size_ + 1);
+      }
+      return;
+    }
+    product_[2 * size_] = 0;
+    for (size_t i = 0; i < size_; ++i) {
+      Limb carry = LimbArithmetic::AddMultiple(product_.data() + i, limbs, size_, product_[i] * inverse_);
+      for (size_t j = i + size_; carry != 0; ++j) {
+        product_[j] += carry;
+        carry = product_[j] < carry ? 1 : 0;
+      }
+    }
+    Limb* high = product_.data() + size_;
+    if (high[size_] != 0 || LimbArithmetic::Compare(high, size_, limbs, size_) >= 0) {
+      LimbArithmetic::Subtract(high, high, size_ + 1, limbs, size_);
+    }
+    std::copy(high, high + size_, out);
+  }
+
+  void MultiplyReduced(Limb* out, const Limb* first, const Limb* second) {
+    if (first == second) {
+      Multiplier::Instance().Square(product_.data(), first, size_);
+    } else {
+      Multiplier::Instance().Multiply(product_.data(), first, size_, second, size_);
+    }
+    Reduce(out);
+  }
+
+  void Load(Limb* out, const BigInteger& value) {
+    BigInteger residue = Residue(value);
+    std::fill(out, out + size_, 0);
+    if (residue.sign_ != zero) {
+      std::copy(residue.nums_.begin(), residue.nums_.end(), out);
+    }
+    if (IsMontgomery()) {
+      MultiplyReduced(out, out, square_.data());
+    }
+  }
+
+  BigInteger Store(const Limb* value) {
+    std::vector<Limb> limbs(value, value + size_);
+    if (IsMontgomery()) {
+      std::fill(product_.begin(), product_.end(), 0);
+      std::copy(value, value + size_, product_.begin());
+      Reduce(limbs.data());
+    }
+    BigInteger answer;
+    size_t size = LimbArithmetic::Normalize(limbs.data(), size_);
+    if (size != 0) {
+      answer.nums_.assign(limbs.data(), limbs.data() + size);
+      answer.sign_ = plus;
+    }
+    return answer;
+  }
+
+public:
+  explicit ModContext(const BigInteger& modulus) : modulus_(modulus.Abs()), size_(modulus_.nums_.size()) {
+    if (modulus_.sign_ == zero) {
+      throw std::domain_error("ModContext modulus is zero");
+    }
+    product_.resize(2 * size_ + 1);
+    scratch_.resize(4 * size_ + 3);
+  }
+
+  const BigInteger& Modulus() const {
+    return modulus_;
+  }
+
+  BigInteger Residue(const BigInteger& value) const {
+    if (value.sign_ == plus && value < modulus_) {
+      return value;
+    }
+    BigInteger quotient;
+    BigInteger remainder;
+    divmod(value, modulus_, quotient, remainder);
+    if (remainder.sign_ == minus) {
+      remainder += modulus_;
+    }
+    return remainder;
+  }
+
+  BigInteger Multiply(const BigInteger& first, const BigInteger& second) {
+    return Residue(Residue(first) * Residue(second));
+  }
+
+  BigInteger Power(const BigInteger& base, const BigInteger& exponent) {
+    if (exponent.sign_ == minus) {
+      throw std::domain_error("ModContext exponent is negative");
+    }
+    if (exponent.sign_ == zero) {
+      return Residue(1);
+    }
+    if (IsMontgomery()) {
+      PrepareMontgomery();
+    }
+    size_t exponent_bits = exponent.bit_length();
+    size_t window = WindowBits(exponent_bits);
+    table_.resize(size_ << (window - 1));
+    Load(table_.data(), base);
+    std::vector<Limb> result(size_);
+    if (window > 1) {
+      MultiplyReduced(result.data(), table_.data(), table_.data());
+      for (size_t i = 1; i < (size_t(1) << (window - 1)); ++i) {
+        MultiplyReduced(table_.data() + i * size_, table_.data() + (i - 1) * size_, result.data());
+      }
+    }
+    bool started = false;
+    for (size_t bit = exponent_bits; bit > 0;) {
+      if (!exponent.test_bit(bit - 1)) {
+        MultiplyReduced(result.data(), result.data(), result.data());
+        --bit;
+        continue;
+      }
+      size_t low = bit > window ? bit - window : 0;
+      while (!exponent.test_bit(low)) {
+        ++low;
+      }
+      size_t value = 0;
+      for (size_t i = bit; i > low; --i) {
+        value = 2 * value + exponent.test_bit(i - 1);
+        if (started) {
+          MultiplyReduced(result.data(), result.data(), result.data());
+        }
+      }
+      const Limb* power = table_.data() + (value / 2) * size_;
+      if (started) {
+        MultiplyReduced(result.data(), result.data(), power);
+      } else {
+        std::copy(power, power + size_, result.begin());
+        started = true;
+      }
+      bit = low;
+    }
+    return Store(result.data());
+  }
+};
+
+BigInteger mulmod(const BigInteger& first, const BigInteger& second, const BigInteger& modulus) {
+  return ModContext(modulus).Multiply(first, second);
 }
 
-BigInteger operator""_bi(unsigned long long number) {
-  BigInteger ans(number);
-  return ans;
+BigInteger powmod(const BigInteger& base, const BigInteger& exponent, const BigInteger& modulus) {
+  return ModContext(modulus).Power(base, exponent);
 }
 
-void swap(BigInteger& first, BigInteger& second) {
-  first.Swap(second);
+class ProductTree {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  std::vector<std::vector<BigInteger>> levels_;
+
+  static void MultiplyPairs(const std::vector<BigInteger>& level, std::vector<BigInteger>& next, size_t begin,
+                            size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      if (2 * i + 1 < level.size()) {
+        next[i] = level[2 * i] * level[2 * i + 1];
+      } else {
+        next[i] = level[2 * i];
+      }
+    }
+  }
+
+  static std::vector<BigInteger> NextLevel(const std::vector<BigInteger>& level) {
+    std::vector<BigInteger> next((level.size() + 1) / 2);
+    size_t limbs = 0;
+    for (const BigInteger& value : level) {
+      limbs += value.nums_.size();
+    }
+    size_t tasks = std::min(Multiplier::thread_cap_, next.size());
+    if (tasks < 2 || limbs < Multiplier::parallel_threshold_) {
+      MultiplyPairs(level, next, 0, next.size());
+      return next;
+    }
+    std::vector<std::future<void>> futures;
+    size_t chunk = (next.size() + tasks - 1) / tasks;
+    for (size_t begin = chunk; begin < next.size(); begin += chunk) {
+      size_t end = std::min(begin + chunk, next.size());
+      futures.push_back(Multiplier::Launch([&level, &next, begin, end] {
+        MultiplyPairs(level, next, begin, end);
+      }));
+    }
+    MultiplyPairs(level, next, 0, std::min(chunk, next.size()));
+    for (std::future<void>& future : futures) {
+      future.get();
+    }
+    return next;
+  }
+
+public:
+  explicit ProductTree(std::vector<BigInteger> leaves) {
+    if (leaves.empty()) {
+      leaves.push_back(1);
+    }
+    levels_.push_back(std::move(leaves));
+    while (levels_.back().size() > 1) {
+      levels_.push_back(NextLevel(levels_.back()));
+    }
+  }
+
+  static void Pack(std::vector<BigInteger>& values, Limb& packed, Limb factor) {
+    LimbArithmetic::DoubleLimb product = static_cast<LimbArithmetic::DoubleLimb>(packed) * factor;
+    if ((product >> LimbArithmetic::kLimbBits) == 0) {
+      packed = static_cast<Limb>(product);
+      return;
+    }
+    values.emplace_back(static_cast<unsigned long long>(packed));
+    packed = factor;
+  }
+
+  static BigInteger Multiply(std::vector<BigInteger> values) {
+    while (values.size() > 1) {
+      values = NextLevel(values);
+    }
+    return values.empty() ? BigInteger(1) : std::move(values[0]);
+  }
+
+  const BigInteger& Root() const {
+    return levels_.back()[0];
+  }
+
+  const std::vector<BigInteger>& Leaves() const {
+    return levels_[0];
+  }
+
+  std::vector<BigInteger> Remainders(const BigInteger& value, bool squared) const {
+    std::vector<BigInteger> current(1, value);
+    for (size_t level = levels_.size(); level > 0; --level) {
+      const std::vector<BigInteger>& nodes = levels_[level - 1];
+      std::vector<BigInteger> next(nodes.size());
+      for (size_t i = 0; i < nodes.size(); ++i) {
+        next[i] = squared ? current[i / 2] % (nodes[i] * nodes[i]) : current[i / 2] % nodes[i];
+      }
+      current = std::move(next);
+    }
+    return current;
+  }
+};
+
+template <typename Iterator>
+BigInteger product(Iterator first, Iterator last) {
+  std::vector<BigInteger> values;
+  LimbArithmetic::Limb packed = 1;
+  bool negative = false;
+  using Value = typename std::iterator_traits<Iterator>::value_type;
+  for (; first != last; ++first) {
+    BigInteger value;
+    if constexpr (std::is_integral_v<Value> && std::is_signed_v<Value>) {
+      value = BigInteger(static_cast<int64_t>(*first));
+    } else if constexpr (std::is_integral_v<Value>) {
+      value = BigInteger(static_cast<unsigned long long>(*first));
+    } else {
+      value = *first;
+    }
+    if (value.sign_ == zero) {
+      return 0;
+    }
+    negative ^= value.sign_ == minus;
+    if (value.nums_.size() == 1) {
+      ProductTree::Pack(values, packed, value.nums_[0]);
+    } else {
+      value.sign_ = plus;
+      values.push_back(std::move(value));
+    }
+  }
+  values.emplace_back(static_cast<unsigned long long>(packed));
+  BigInteger answer = ProductTree::Multiply(std::move(values));
+  return negative ? -answer : answer;
+}
+
+template <typename Range>
+BigInteger product(const Range& range) {
+  return product(std::begin(range), std::end(range));
+}
+
+BigInteger factorial(uint64_t number) {
+  BigInteger answer = 1;
+  BigInteger odd = 1;
+  int bits = number == 0 ? 0 : 64 - __builtin_clzll(number);
+  for (int i = bits - 1; i >= 0; --i) {
+    uint64_t low = number >> (i + 1);
+    uint64_t high = number >> i;
+    std::vector<BigInteger> values;
+    LimbArithmetic::Limb packed = 1;
+    for (uint64_t factor = low + 1 + (low & 1); factor <= high; factor += 2) {
+      ProductTree::Pack(values, packed, factor);
+    }
+    values.emplace_back(static_cast<unsigned long long>(packed));
+    odd *= ProductTree::Multiply(std::move(values));
+    answer *= odd;
+  }
+  answer <<= number - static_cast<uint64_t>(__builtin_popcountll(number));
+  return answer;
+}
+
+std::vector<BigInteger> remainders(const BigInteger& value, const std::vector<BigInteger>& moduli) {
+  if (moduli.empty()) {
+    return {};
+  }
+  return ProductTree(moduli).Remainders(value, false);
+}
+
+std::vector<BigInteger> batch_gcd(const std::vector<BigInteger>& numbers) {
+  if (numbers.empty()) {
+    return {};
+  }
+  std::vector<BigInteger> nonzero;
+  for (const BigInteger& number : numbers) {
+    if (number.sign_ != zero) {
+      nonzero.push_back(number);
+    }
+  }
+  if (nonzero.size() < numbers.size()) {
+    std::vector<BigInteger> answer(numbers.size());
+    for (size_t i = 0; i < numbers.size(); ++i) {
+      if (numbers[i].sign_ != zero) {
+        answer[i] = numbers[i].Abs();
+      } else if (nonzero.size() + 1 == numbers.size()) {
+        answer[i] = ProductTree::Multiply(std::move(nonzero)).Abs();
+      }
+    }
+    return answer;
+  }
+  ProductTree tree(numbers);
+  std::vector<BigInteger> answer = tree.Remainders(tree.Root(), true);
+  for (size_t i = 0; i < answer.size(); ++i) {
+    answer[i] = gcd(answer[i] / numbers[i], numbers[i]);
+  }
+  return answer;
+}
+
+class RootEngine {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  static BigInteger Power(const BigInteger& base, uint64_t exponent) {
+    BigInteger answer = 1;
+    BigInteger power = base;
+    for (; exponent > 0; exponent >>= 1) {
+      if ((exponent & 1) != 0) {
+        answer *= power;
+      }
+      if (exponent > 1) {
+        power *= power;
+      }
+    }
+    return answer;
+  }
+
+  static bool PowerAtMost(const BigInteger& base, uint64_t exponent, const BigInteger& limit) {
+    BigInteger answer = 1;
+    BigInteger power = base;
+    for (; exponent > 0; exponent >>= 1) {
+      if ((exponent & 1) != 0) {
+        answer *= power;
+        if (answer > limit) {
+          return false;
+        }
+      }
+      if (exponent > 1) {
+        power *= power;
+        if (power > limit) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  static bool PowerAtMost(uint64_t base, uint64_t exponent, uint64_t limit) {
+    if (base <= 1) {
+      return base <= limit;
+    }
+    LimbArithmetic::DoubleLimb power = 1;
+    for (uint64_t i = 0; i < exponent; ++i) {
+      power *= base;
+      if (power > limit) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static uint64_t SmallRoot(uint64_t number, uint64_t degree) {
+    uint64_t root = static_cast<uint64_t>(std::pow(static_cast<double>(number), 1.0 / static_cast<double>(degree)));
+    while (root > 0 && !PowerAtMost(root, degree, number)) {
+      --root;
+    }
+    while (PowerAtMost(root + 1, degree, number)) {
+      ++root;
+    }
+    return root;
+  }
+
+public:
+  static BigInteger Root(const BigInteger& number, uint64_t degree) {
+    if (degree >= number.bit_length()) {
+      return number.sign_ == zero ? 0 : 1;
+    }
+    if (number.nums_.size() == 1) {
+      return BigInteger(static_cast<unsigned long long>(SmallRoot(number.nums_[0], degree)));
+    }
+    size_t shift = number.bit_length() / (2 * degree);
+    if (shift == 0) {
+      BigInteger root = 1;
+      while (PowerAtMost(root + 1, degree, number)) {
+        ++root;
+      }
+      return root;
+    }
+    BigInteger root = (Root(number >> (shift * degree), degree) + 1) << shift;
+    BigInteger factor(static_cast<unsigned long long>(degree - 1));
+    BigInteger divisor(static_cast<unsigned long long>(degree));
+    while (true) {
+      BigInteger next = number / Power(root, degree - 1);
+      next += ProductExpression(factor, root);
+      next /= divisor;
+      if (next >= root) {
+        return root;
+      }
+      root = std::move(next);
+    }
+  }
+
+  static bool MayBeSquare(const BigInteger& number) {
+    constexpr uint64_t kSquaresModulo64 = 0x202021202030213;
+    constexpr uint64_t kSquaresModulo63 = 0x402483012450293;
+    constexpr uint64_t kSquaresModulo17 = 0x1a317;
+    constexpr uint64_t kSquaresModulo19 = 0x30af3;
+    constexpr uint64_t kSquaresModulo11 = 0x23b;
+    if (((kSquaresModulo64 >> (number.nums_[0] & 63)) & 1) == 0) {
+      return false;
+    }
+    std::vector<Limb> quotient(number.nums_.size());
+    Limb residue = LimbArithmetic::DivideSmall(quotient.data(), number.nums_.data(), number.nums_.size(),
+                                               63 * 17 * 19 * 11);
+    return ((kSquaresModulo63 >> (residue % 63)) & 1) != 0 && ((kSquaresModulo17 >> (residue % 17)) & 1) != 0 &&
+           ((kSquaresModulo19 >> (residue % 19)) & 1) != 0 && ((kSquaresModulo11 >> (residue % 11)) & 1) != 0;
+  }
+};
+
+BigInteger iroot(const BigInteger& number, uint64_t degree) {
+  if (degree == 0 || (number.sign_ == minus && degree % 2 == 0)) {
+    throw std::domain_error("iroot of this degree is undefined");
+  }
+  if (number.sign_ == zero || degree == 1) {
+    return number;
+  }
+  BigInteger root = RootEngine::Root(number.Abs(), degree);
+  return number.sign_ == minus ? -root : root;
+}
+
+BigInteger isqrt(const BigInteger& number) {
+  return iroot(number, 2);
+}
+
+bool is_perfect_square(const BigInteger& number) {
+  if (number.sign_ != plus) {
+    return number.sign_ == zero;
+  }
+  if (!RootEngine::MayBeSquare(number)) {
+    return false;
+  }
+  BigInteger root = isqrt(number);
+  return root * root == number;
 }
 
-BigInteger operator+(const BigInteger& first, const BigInteger& other) {
-  BigInteger temp = first;
-  temp += other;
-  return temp;
-}
+template <size_t Bits>
+class FixedInt {
+  static_assert(Bits > 0 && Bits % LimbArithmetic::kLimbBits == 0);
+
+public:
+  using Limb = LimbArithmetic::Limb;
+
+  static constexpr size_t kLimbs = Bits / LimbArithmetic::kLimbBits;
+
+private:
+  constexpr size_t Size() const {
+    return LimbArithmetic::Normalize(nums_.data(), kLimbs);
+  }
+
+  constexpr void FixSign(Sign sign) {
+    sign_ = Size() == 0 ? zero : sign;
+  }
+
+  static constexpr bool AddSigned(const FixedInt& first, const FixedInt& second, Sign second_sign, FixedInt& out) {
+    FixedInt answer;
+    if (second_sign == zero) {
+      answer = first;
+    } else if (first.sign_ == zero) {
+      answer = second;
+      answer.sign_ = second_sign;
+    } else if (first.sign_ == second_sign) {
+      if (LimbArithmetic::Add(answer.nums_.data(), first.nums_.data(), kLimbs, second.nums_.data(), kLimbs) != 0) {
+        return false;
+      }
+      answer.sign_ = second_sign;
+    } else if (LimbArithmetic::Compare(first.nums_.data(), kLimbs, second.nums_.data(), kLimbs) >= 0) {
+      LimbArithmetic::Subtract(answer.nums_.data(), first.nums_.data(), kLimbs, second.nums_.data(), kLimbs);
+      answer.FixSign(first.sign_);
+    } else {
+      LimbArithmetic::Subtract(answer.nums_.data(), second.nums_.data(), kLimbs, first.nums_.data(), kLimbs);
+      answer.sign_ = second_sign;
+    }
+    out = answer;
+    return true;
+  }
+
+  static constexpr void Check(bool success) {
+    if (!success) {
+      throw std::overflow_error("FixedInt overflow");
+    }
+  }
+
+public:
+  Sign sign_;
+  std::array<Limb, kLimbs> nums_;
+
+  constexpr FixedInt() : FixedInt(0) {}
+
+  constexpr FixedInt(int other) : FixedInt(static_cast<int64_t>(other)) {}
+
+  explicit constexpr FixedInt(int64_t other) : sign_(zero), nums_{} {
+    if (other > 0) {
+      sign_ = plus;
+      nums_[0] = static_cast<Limb>(other);
+    } else if (other < 0) {
+      sign_ = minus;
+      nums_[0] = 0 - static_cast<Limb>(other);
+    }
+  }
+
+  explicit constexpr FixedInt(unsigned long long other) : sign_(other == 0 ? zero : plus), nums_{} {
+    nums_[0] = other;
+  }
+
+  explicit FixedInt(const BigInteger& other) : sign_(other.sign_), nums_{} {
+    Check(other.nums_.size() <= kLimbs);
+    std::copy(other.nums_.begin(), other.nums_.end(), nums_.begin());
+  }
+
+  template <char... Digits>
+  static constexpr FixedInt FromDigits() {
+    constexpr char digits[] = {Digits...};
+    size_t begin = 0;
+    Limb base = 10;
+    if (sizeof...(Digits) > 1 && digits[0] == '0') {
+      if (digits[1] == 'x' || digits[1] == 'X') {
+        begin = 2;
+        base = 16;
+      } else if (digits[1] == 'b' || digits[1] == 'B') {
+        begin = 2;
+        base = 2;
+      } else {
+        begin = 1;
+        base = 8;
+      }
+    }
+    if (begin == sizeof...(Digits)) {
+      throw std::domain_error("FixedInt literal has no digits");
+    }
+    FixedInt answer;
+    for (size_t i = begin; i < sizeof...(Digits); ++i) {
+      char digit = digits[i];
+      if (digit == '\'') {
+        continue;
+      }
+      Limb value = digit >= 'a' && digit <= 'f'   ? digit - 'a' + 10
+                   : digit >= 'A' && digit <= 'F' ? digit - 'A' + 10
+                   : digit >= '0' && digit <= '9' ? digit - '0'
+                                                  : base;
+      if (value >= base) {
+        throw std::domain_error("FixedInt literal has an invalid digit");
+      }
+      Check(LimbArithmetic::MultiplySmall(answer.nums_.data(), answer.nums_.data(), kLimbs, base) == 0);
+      Check(LimbArithmetic::Add(answer.nums_.data(), answer.nums_.data(), kLimbs, &value, 1) == 0);
+    }
+    answer.FixSign(plus);
+    return answer;
+  }
+
+
+  static constexpr bool Add(const FixedInt& first, const FixedInt& second, FixedInt& out) {
+    return AddSigned(first, second, second.sign_, out);
+  }
+
+  static constexpr bool Subtract(const FixedInt& first, const FixedInt& second, FixedInt& out) {
+    return AddSigned(first, second, static_cast<Sign>(-second.sign_), out);
+  }
+
+  static constexpr bool Multiply(const FixedInt& first, const FixedInt& second, FixedInt& out) {
+    std::array<Limb, 2 * kLimbs> product{};
+    LimbArithmetic::MultiplySchoolbook(product.data(), first.nums_.data(), first.Size(), second.nums_.data(),
+                                       second.Size());
+    if (LimbArithmetic::Normalize(product.data(), 2 * kLimbs) > kLimbs) {
+      return false;
+    }
+    Sign sign = static_cast<Sign>(first.sign_ * second.sign_);
+    std::copy(product.begin(), product.begin() + kLimbs, out.nums_.begin());
+    out.FixSign(sign);
+    return true;
+  }
+
+  static constexpr void Divide(const FixedInt& dividend, const FixedInt& divisor, FixedInt& quotient,
+                               FixedInt& remainder) {
+    size_t dividend_size = dividend.Size();
+    size_t divisor_size = divisor.Size();
+    if (divisor_size == 0) {
+      quotient = dividend;
+      remainder = dividend;
+      return;
+    }
+    FixedInt quotient_answer;
+    FixedInt remainder_answer;
+    if (LimbArithmetic::Compare(dividend.nums_.data(), dividend_size, divisor.nums_.data(), divisor_size) < 0) {
+      remainder_answer = dividend;
+    } else if (divisor_size == 1) {
+      remainder_answer.nums_[0] = LimbArithmetic::DivideSmall(quotient_answer.nums_.data(), dividend.nums_.data(),
+                                                              dividend_size, divisor.nums_[0]);
+    } else {
+      std::array<Limb, 2 * kLimbs + 2> scratch{};
+      LimbArithmetic::DivideKnuth(quotient_answer.nums_.data(), remainder_answer.nums_.data(), dividend.nums_.data(),
+                                  dividend_size, divisor.nums_.data(), divisor_size, scratch.data());
+    }
+    quotient_answer.FixSign(static_cast<Sign>(dividend.sign_ * divisor.sign_));
+    remainder_answer.FixSign(dividend.sign_);
+    quotient = quotient_answer;
+    remainder = remainder_answer;
+  }
+
+  constexpr FixedInt& operator+=(const FixedInt& other) {
+    Check(Add(*this, other, *this));
+    return *this;
+  }
+
+  constexpr FixedInt& operator-=(const FixedInt& other) {
+    Check(Subtract(*this, other, *this));
+    return *this;
+  }
+
+  constexpr FixedInt& operator*=(const FixedInt& other) {
+    Check(Multiply(*this, other, *this));
+    return *this;
+  }
+
+  constexpr FixedInt& operator/=(const FixedInt& other) {
+    FixedInt remainder;
+    Divide(*this, other, *this, remainder);
+    return *this;
+  }
+
+  constexpr FixedInt& operator%=(const FixedInt& other) {
+    FixedInt quotient;
+    Divide(*this, other, quotient, *this);
+    return *this;
+  }
+
+  constexpr FixedInt operator-() const {
+    FixedInt answer = *this;
+    answer.sign_ = static_cast<Sign>(-sign_);
+    return answer;
+  }
+
+  constexpr FixedInt& operator++() {
+    return *this += 1;
+  }
+
+  constexpr FixedInt operator++(int) {
+    FixedInt copy = *this;
+    *this += 1;
+    return copy;
+  }
+
+  constexpr FixedInt& operator--() {
+    return *this -= 1;
+  }
+
+  constexpr FixedInt operator--(int) {
+    FixedInt copy = *this;
+    *this -= 1;
+    return copy;
+  }
+
+  constexpr bool operator==(const FixedInt& other) const {
+    return sign_ == other.sign_ && nums_ == other.nums_;
+  }
+
+  constexpr std::strong_ordering operator<=>(const FixedInt& other) const {
+    if (sign_ != other.sign_ || sign_ == zero) {
+      return sign_ <=> other.sign_;
+    }
+    int comparison = LimbArithmetic::Compare(nums_.data(), kLimbs, other.nums_.data(), kLimbs);
+    return sign_ == plus ? comparison <=> 0 : 0 <=> comparison;
+  }
+
+  explicit constexpr operator bool() const {
+    return sign_ != zero;
+  }
+
+  constexpr FixedInt Abs() const {
+    FixedInt answer = *this;
+    if (answer.sign_ == minus) {
+      answer.sign_ = plus;
+    }
+    return answer;
+  }
+
+  operator BigInteger() const {
+    BigInteger answer;
+    size_t size = Size();
+    if (size != 0) {
+      answer.nums_.assign(nums_.data(), nums_.data() + size);
+      answer.sign_ = sign_;
+    }
+    return answer;
+  }
+
+  std::string toString() const {
+    return static_cast<BigInteger>(*this).toString();
+  }
+
+  friend constexpr FixedInt operator+(const FixedInt& first, const FixedInt& second) {
+    FixedInt answer = first;
+    answer += second;
+    return answer;
+  }
 
-BigInteger operator-(const BigInteger& first, const BigInteger& other) {
-  BigInteger temp = first;
-  temp -= other;
-  return temp;
-}
+  friend constexpr FixedInt operator-(const FixedInt& first, const FixedInt& second) {
+    FixedInt answer = first;
+    answer -= second;
+    return answer;
+  }
 
-BigInteger operator*(const BigInteger& first, const BigInteger& other) {
-  BigInteger temp = first;
-  temp *= other;
-  return temp;
-}
+  friend constexpr FixedInt operator*(const FixedInt& first, const FixedInt& second) {
+    FixedInt answer = first;
+    answer *= second;
+    return answer;
+  }
 
-BigInteger& BigInteger::operator/=(const BigInteger& other) {
-  if (other.sign_ == zero || sign_ == zero) {
-    return *this;
+  friend constexpr FixedInt operator/(const FixedInt& first, const FixedInt& second) {
+    FixedInt answer = first;
+    answer /= second;
+    return answer;
   }
-  BigInteger positive_other = other.Abs();
-  BigInteger ten = 10;
-  BigInteger deg_ten = 1;
-  int count = 0;
-  BigInteger abs_this = Abs();
-  while (positive_other * ten <= abs_this) {
-    positive_other *= ten;
-    deg_ten *= ten;
-    ++count;
-  }
-  BigInteger copy = abs_this;
-  Sign sign = sign_;
-  *this = 0;
-  for (int i = 0; i < count; ++i) {
-    while (copy >= positive_other) {
-      copy -= positive_other;
-      *this += deg_ten;
-    }
-    positive_other.DivideTen();
-    deg_ten.DivideTen();
-  }
-  while (copy >= positive_other) {
-    copy -= positive_other;
-    *this += deg_ten;
-  }
-  if (*this == 0) {
-    return *this;
+
+  friend constexpr FixedInt operator%(const FixedInt& first, const FixedInt& second) {
+    FixedInt answer = first;
+    answer %= second;
+    return answer;
   }
-  if ((sign == minus && other.sign_ == plus) || (sign == plus && other.sign_ == minus)) {
-    sign_ = minus;
-  } else {
-    sign_ = plus;
+
+  friend std::ostream& operator<<(std::ostream& out, const FixedInt& other) {
+    out << other.toString();
+    return out;
   }
-  return *this;
-}
+};
 
-BigInteger operator/(const BigInteger& first, const BigInteger& other) {
-  BigInteger temp = first;
-  temp /= other;
-  return temp;
-}
+using Int128 = FixedInt<128>;
+using Int256 = FixedInt<256>;
+using Int512 = FixedInt<512>;
 
-BigInteger& BigInteger::operator%=(const BigInteger& other) {
-  BigInteger temp = *this;
-  temp /= other;
-  *this -= temp * other;
-  return *this;
+template <char... Digits>
+consteval Int128 operator""_i128() {
+  return Int128::FromDigits<Digits...>();
 }
 
-BigInteger operator%(const BigInteger& first, const BigInteger& other) {
-  BigInteger temp = first;
-  temp %= other;
-  return temp;
+template <char... Digits>
+consteval Int256 operator""_i256() {
+  return Int256::FromDigits<Digits...>();
 }
 
+template <char... Digits>
+consteval Int512 operator""_i512() {
+  return Int512::FromDigits<Digits...>();
+}
 
 class Rational {
 private:
   BigInteger up_;
   BigInteger low_;
 
+  friend class RationalAccumulator;
+
+  friend class BinaryFormat;
+
   void MakeMutuallySimple() {
-    BigInteger null = 0;
-    if (up_ == null) {
+    if (up_.sign_ == zero) {
       low_ = 1;
       return;
     }
-    BigInteger up_copy = up_;
-    BigInteger low_copy = low_;
-    while (up_copy != null && low_copy != null) {
-      if (up_copy.Abs() > low_copy.Abs()) {
-        up_copy %= low_copy;
-      } else {
-        low_copy %= up_copy;
-      }
+    thread_local BigInteger divisor;
+    GcdEngine::Instance().Gcd(up_, low_, divisor);
+    if (divisor.nums_.size() != 1 || divisor.nums_[0] != 1) {
+      up_ /= divisor;
+      low_ /= divisor;
+    }
+    if (low_.sign_ == minus) {
+      low_.sign_ = plus;
+      up_.sign_ = up_.sign_ == minus ? plus : minus;
     }
-    BigInteger gcd;
-    if (up_copy != null) {
-      gcd = up_copy;
+  }
+
+  static constexpr size_t kLeadingBits = 62;
+
+  static constexpr int64_t kQuotientBits = 66;
+
+  static LimbArithmetic::Limb LeadingBits(const BigInteger& number, size_t bit_length, size_t& exponent) {
+    if (bit_length <= kLeadingBits) {
+      exponent = 0;
+      return number.nums_[0];
+    }
+    exponent = bit_length - kLeadingBits;
+    size_t limb = exponent / LimbArithmetic::kLimbBits;
+    LimbArithmetic::DoubleLimb window = number.nums_[limb];
+    if (limb + 1 < number.nums_.size()) {
+      window |= static_cast<LimbArithmetic::DoubleLimb>(number.nums_[limb + 1]) << LimbArithmetic::kLimbBits;
+    }
+    return static_cast<LimbArithmetic::Limb>(window >> (exponent % LimbArithmetic::kLimbBits));
+  }
+
+  static std::partial_ordering EstimateProducts(const BigInteger& first, const BigInteger& second,
+                                                const BigInteger& third, const BigInteger& fourth) {
+    size_t first_bits = first.bit_length();
+    size_t second_bits = second.bit_length();
+    size_t third_bits = third.bit_length();
+    size_t fourth_bits = fourth.bit_length();
+    if (first_bits + second_bits + 1 < third_bits + fourth_bits) {
+      return std::partial_ordering::less;
+    }
+    if (first_bits + second_bits > third_bits + fourth_bits + 1) {
+      return std::partial_ordering::greater;
+    }
+    size_t exponents[4];
+    LimbArithmetic::Limb leading[4] = {
+        LeadingBits(first, first_bits, exponents[0]), LeadingBits(second, second_bits, exponents[1]),
+        LeadingBits(third, third_bits, exponents[2]), LeadingBits(fourth, fourth_bits, exponents[3])};
+    LimbArithmetic::DoubleLimb lower = static_cast<LimbArithmetic::DoubleLimb>(leading[0]) * leading[1];
+    LimbArithmetic::DoubleLimb upper = static_cast<LimbArithmetic::DoubleLimb>(leading[0] + (exponents[0] != 0)) *
+                                       (leading[1] + (exponents[1] != 0));
+    LimbArithmetic::DoubleLimb other_lower = static_cast<LimbArithmetic::DoubleLimb>(leading[2]) * leading[3];
+    LimbArithmetic::DoubleLimb other_upper =
+        static_cast<LimbArithmetic::DoubleLimb>(leading[2] + (exponents[2] != 0)) * (leading[3] + (exponents[3] != 0));
+    size_t exponent = exponents[0] + exponents[1];
+    size_t other_exponent = exponents[2] + exponents[3];
+    if (exponent > other_exponent) {
+      lower <<= exponent - other_exponent;
+      upper <<= exponent - other_exponent;
     } else {
-      gcd = low_copy;
+      other_lower <<= other_exponent - exponent;
+      other_upper <<= other_exponent - exponent;
     }
-    up_ /= gcd;
-    low_ /= gcd;
-    if (low_ < null) {
-      low_ = - low_;
-      up_ = -up_;
+    if (upper < other_lower || (upper == other_lower && lower != upper)) {
+      return std::partial_ordering::less;
+    }
+    if (other_upper < lower || (other_upper == lower && other_lower != other_upper)) {
+      return std::partial_ordering::greater;
     }
+    if (lower == upper && other_lower == other_upper) {
+      return lower <=> other_lower;
+    }
+    return std::partial_ordering::unordered;
   }
 
 public:
@@ -570,9 +2950,25 @@ public:
   Rational() : up_(0), low_(1) {}
 
   Rational& operator+=(const Rational& other) {
-    up_ = up_ * other.low_ + low_ * other.up_;
-    low_ = low_ * other.low_;
-    MakeMutuallySimple();
+    if (this == &other) {
+      Rational copy = other;
+      return *this += copy;
+    }
+    BigInteger first_divisor = gcd(low_, other.low_);
+    if (first_divisor == 1) {
+      up_ = ProductExpression(up_, other.low_) + ProductExpression(low_, other.up_);
+      low_ *= other.low_;
+    } else {
+      BigInteger low_part = low_ / first_divisor;
+      BigInteger other_part = other.low_ / first_divisor;
+      up_ = ProductExpression(up_, other_part) + ProductExpression(other.up_, low_part);
+      BigInteger second_divisor = gcd(up_, first_divisor);
+      up_ /= second_divisor;
+      low_ = low_part * (other.low_ / second_divisor);
+    }
+    if (up_.sign_ == zero) {
+      low_ = 1;
+    }
     return *this;
   }
 
@@ -582,16 +2978,37 @@ public:
   }
 
   Rational& operator*=(const Rational& other) {
-    up_ *= other.up_;
-    low_ *= other.low_;
-    MakeMutuallySimple();
+    if (this == &other) {
+      up_ *= up_;
+      low_ *= low_;
+      return *this;
+    }
+    BigInteger first_divisor = gcd(up_, other.low_);
+    BigInteger second_divisor = gcd(other.up_, low_);
+    up_ = (up_ / first_divisor) * (other.up_ / second_divisor);
+    low_ = (low_ / second_divisor) * (other.low_ / first_divisor);
+    if (up_.sign_ == zero) {
+      low_ = 1;
+    }
     return *this;
   }
 
   Rational& operator/=(const Rational& other) {
-    up_ *= other.low_;
-    low_ *= other.up_;
-    MakeMutuallySimple();
+    if (this == &other) {
+      *this = up_.sign_ == zero ? 0 : 1;
+      return *this;
+    }
+    BigInteger first_divisor = gcd(up_, other.up_);
+    BigInteger second_divisor = gcd(other.low_, low_);
+    up_ = (up_ / first_divisor) * (other.low_ / second_divisor);
+    low_ = (low_ / second_divisor) * (other.up_ / first_divisor);
+    if (low_.sign_ == minus) {
+      low_ = -low_;
+      up_ = -up_;
+    }
+    if (up_.sign_ == zero) {
+      low_ = 1;
+    }
     return *this;
   }
 
@@ -604,15 +3021,17 @@ public:
   }
 
   std::strong_ordering operator<=>(const Rational& other) const {
-    BigInteger first = up_ * other.low_;
-    BigInteger second = low_ * other.up_;
-    if (first < second) {
-      return std::strong_ordering::less;
+    if (up_.sign_ != other.up_.sign_ || up_.sign_ == zero) {
+      return up_.sign_ <=> other.up_.sign_;
     }
-    if (first > second) {
-      return std::strong_ordering::greater;
+    std::partial_ordering estimate = EstimateProducts(up_, other.low_, other.up_, low_);
+    if (estimate == std::partial_ordering::unordered) {
+      return ProductExpression(up_, other.low_) <=> ProductExpression(other.up_, low_);
     }
-    return std::strong_ordering::equal;
+    std::strong_ordering magnitude = estimate < 0   ? std::strong_ordering::less
+                                     : estimate > 0 ? std::strong_ordering::greater
+                                                    : std::strong_ordering::equal;
+    return up_.sign_ == plus ? magnitude : 0 <=> magnitude;
   }
 
   std::string toString() const {
@@ -627,10 +3046,17 @@ public:
   }
 
   std::string asDecimal(const size_t precision = 0) const {
-    BigInteger temp = up_;
-    for (size_t i = 0; i < precision; ++i) {
-      temp *= 10;
+    BigInteger scale = 1;
+    BigInteger power = 10;
+    for (size_t rest = precision; rest > 0; rest >>= 1) {
+      if ((rest & 1) != 0) {
+        scale *= power;
+      }
+      if (rest > 1) {
+        power *= power;
+      }
     }
+    BigInteger temp = up_ * scale;
     temp /= low_;
     std::string ans = temp.toString();
 
@@ -660,23 +3086,38 @@ public:
   }
 
   explicit operator double() const {
-    Rational copy = *this;
-    BigInteger ten_deg = static_cast<int>(1e9);
-    ten_deg *= static_cast<int>(1e9);
-    double deg = 1;
-    while (copy < ten_deg) {
-      deg *= 10;
-      copy *= 10;
-    }
-    std::string str = (copy.up_ / copy.low_).toString();
-    double ans = 0;
-    double deg_ten = 1;
-    for (size_t i = str.size(); i > 0; --i) {
-      ans += deg_ten * (str[i - 1] - '0');
-      deg_ten *= 10;
-    }
-    ans /= deg;
-    return ans;
+    if (up_.sign_ == zero) {
+      return 0;
+    }
+    BigInteger numerator = up_.Abs();
+    BigInteger denominator = low_;
+    int64_t shift = kQuotientBits + static_cast<int64_t>(low_.bit_length()) - static_cast<int64_t>(up_.bit_length());
+    if (shift > 0) {
+      numerator <<= static_cast<size_t>(shift);
+    } else {
+      denominator <<= static_cast<size_t>(-shift);
+    }
+    thread_local BigInteger quotient;
+    thread_local BigInteger remainder;
+    divmod(numerator, denominator, quotient, remainder);
+    LimbArithmetic::DoubleLimb bits = quotient.nums_[0];
+    if (quotient.nums_.size() > 1) {
+      bits |= static_cast<LimbArithmetic::DoubleLimb>(quotient.nums_[1]) << LimbArithmetic::kLimbBits;
+    }
+    int64_t length = static_cast<int64_t>(quotient.bit_length());
+    int64_t lowest = std::max<int64_t>(length - 1 - shift - 52, -1074);
+    int64_t drop = lowest + shift;
+    if (drop > length) {
+      return up_.sign_ == minus ? -0.0 : 0.0;
+    }
+    LimbArithmetic::DoubleLimb mantissa = bits >> drop;
+    LimbArithmetic::DoubleLimb rest = bits - (mantissa << drop);
+    LimbArithmetic::DoubleLimb half = static_cast<LimbArithmetic::DoubleLimb>(1) << (drop - 1);
+    if (rest > half || (rest == half && (remainder.sign_ != zero || (mantissa & 1) != 0))) {
+      ++mantissa;
+    }
+    double answer = std::ldexp(static_cast<double>(mantissa), static_cast<int>(std::min<int64_t>(lowest, 2048)));
+    return up_.sign_ == minus ? -answer : answer;
   }
 
   Rational operator-() const {
@@ -710,3 +3151,370 @@ Rational operator/(const Rational& first, const Rational& second) {
   return ans;
 }
 
+class RationalAccumulator {
+private:
+  BigInteger up_;
+  BigInteger low_;
+  size_t reduce_limbs_ = reduce_threshold_;
+
+  void ReduceIfLarge() {
+    if (std::max(up_.nums_.size(), low_.nums_.size()) > reduce_limbs_) {
+      Reduce();
+    }
+  }
+
+public:
+  static inline size_t reduce_threshold_ = 64;
+
+  RationalAccumulator() : up_(0), low_(1) {}
+
+  RationalAccumulator(const Rational& other) : up_(other.up_), low_(other.low_) {}
+
+  void Reduce() {
+    Rational reduced;
+    reduced.up_.Swap(up_);
+    reduced.low_.Swap(low_);
+    reduced.MakeMutuallySimple();
+    up_.Swap(reduced.up_);
+    low_.Swap(reduced.low_);
+    reduce_limbs_ = std::max(reduce_threshold_, 2 * std::max(up_.nums_.size(), low_.nums_.size()));
+  }
+
+  RationalAccumulator& operator+=(const Rational& other) {
+    BigInteger divisor = gcd(low_, other.low_);
+    if (divisor == 1) {
+      up_ = ProductExpression(up_, other.low_) + ProductExpression(low_, other.up_);
+      low_ *= other.low_;
+    } else {
+      BigInteger other_part = other.low_ / divisor;
+      BigInteger low_part = low_ / divisor;
+      up_ = ProductExpression(up_, other_part) + ProductExpression(other.up_, low_part);
+      low_ *= other_part;
+    }
+    ReduceIfLarge();
+    return *this;
+  }
+
+  RationalAccumulator& operator-=(const Rational& other) {
+    return *this += -other;
+  }
+
+  RationalAccumulator& operator*=(const Rational& other) {
+    up_ *= other.up_;
+    low_ *= other.low_;
+    ReduceIfLarge();
+    return *this;
+  }
+
+  RationalAccumulator& operator/=(const Rational& other) {
+    up_ *= other.low_;
+    low_ *= other.up_;
+    if (low_.sign_ == minus) {
+      low_ = -low_;
+      up_ = -up_;
+    }
+    ReduceIfLarge();
+    return *this;
+  }
+
+  Rational Value() const {
+    RationalAccumulator copy = *this;
+    copy.Reduce();
+    Rational answer;
+    answer.up_.Swap(copy.up_);
+    answer.low_.Swap(copy.low_);
+    return answer;
+  }
+
+  operator Rational() const {
+    return Value();
+  }
+
+  std::string toString() const {
+    return Value().toString();
+  }
+
+  std::strong_ordering operator<=>(const Rational& other) const {
+    return Value() <=> other;
+  }
+
+  bool operator==(const Rational& other) const {
+    return Value() == other;
+  }
+};
+
+class BigIntegerView {
+public:
+  using Limb = LimbArithmetic::Limb;
+
+  Sign sign_ = zero;
+  const char* limbs_ = nullptr;
+  size_t size_ = 0;
+
+  size_t size() const {
+    return size_;
+  }
+
+  Limb operator[](size_t index) const {
+    Limb limb;
+    std::memcpy(&limb, limbs_ + index * sizeof(Limb), sizeof(Limb));
+    if constexpr (std::endian::native == std::endian::big) {
+      limb = __builtin_bswap64(limb);
+    }
+    return limb;
+  }
+
+  BigInteger Materialize() const {
+    BigInteger answer;
+    if (sign_ != zero) {
+      answer.nums_.resize(size_);
+      for (size_t i = 0; i < size_; ++i) {
+        answer.nums_[i] = (*this)[i];
+      }
+      answer.sign_ = sign_;
+    }
+    return answer;
+  }
+};
+
+class BinaryFormat {
+private:
+  using Limb = LimbArithmetic::Limb;
+
+  static void WriteVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+      out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+  }
+
+  static bool ReadVarint(std::istream& in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      int byte = in.get();
+      if (byte == std::char_traits<char>::eof()) {
+        return false;
+      }
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool ReadVarint(std::string_view& in, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (in.empty()) {
+        return false;
+      }
+      uint8_t byte = static_cast<uint8_t>(in[0]);
+      in.remove_prefix(1);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static bool ReadVersion(std::string_view& in) {
+    if (in.empty() || static_cast<uint8_t>(in[0]) != kVersion) {
+      return false;
+    }
+    in.remove_prefix(1);
+    return true;
+  }
+
+  static bool IsReduced(const Rational& value) {
+    return value.low_.sign_ == plus && gcd(value.up_, value.low_) == 1;
+  }
+
+  static void WriteValue(std::string& out, const BigInteger& value) {
+    size_t size = value.sign_ == zero ? 0 : value.nums_.size();
+    WriteVarint(out, (static_cast<uint64_t>(size) << 1) | (value.sign_ == minus ? 1 : 0));
+    size_t offset = out.size();
+    out.resize(offset + size * sizeof(Limb));
+    if constexpr (std::endian::native == std::endian::little) {
+      if (size != 0) {
+        std::memcpy(out.data() + offset, value.nums_.data(), size * sizeof(Limb));
+      }
+    } else {
+      for (size_t i = 0; i < size; ++i) {
+        Limb limb = __builtin_bswap64(value.nums_[i]);
+        std::memcpy(out.data() + offset + i * sizeof(Limb), &limb, sizeof(Limb));
+      }
+    }
+  }
+
+  static void WriteValue(std::string& out, const Rational& value) {
+    WriteValue(out, value.up_);
+    WriteValue(out, value.low_);
+  }
+
+  static bool ReadValue(std::string_view& in, BigIntegerView& view) {
+    uint64_t header = 0;
+    if (!ReadVarint(in, header)) {
+      return false;
+    }
+    uint64_t size = header >> 1;
+    bool negative = (header & 1) != 0;
+    if (size > in.size() / sizeof(Limb) || (size == 0 && negative)) {
+      return false;
+    }
+    view.size_ = static_cast<size_t>(size);
+    view.limbs_ = in.data();
+    view.sign_ = size == 0 ? zero : negative ? minus : plus;
+    if (size != 0 && view[view.size_ - 1] == 0) {
+      return false;
+    }
+    in.remove_prefix(view.size_ * sizeof(Limb));
+    return true;
+  }
+
+  static bool ReadValue(std::string_view& in, BigInteger& value) {
+    BigIntegerView view;
+    if (!ReadValue(in, view)) {
+      return false;
+    }
+    value = view.Materialize();
+    return true;
+  }
+
+  static bool ReadValue(std::string_view& in, Rational& value) {
+    Rational answer;
+    if (!ReadValue(in, answer.up_) || !ReadValue(in, answer.low_) || !IsReduced(answer)) {
+      return false;
+    }
+    value = std::move(answer);
+    return true;
+  }
+
+  static bool ReadValue(std::istream& in, BigInteger& value) {
+    uint64_t header = 0;
+    if (!ReadVarint(in, header)) {
+      return false;
+    }
+    uint64_t size = header >> 1;
+    bool negative = (header & 1) != 0;
+    if (size > kMaxLimbs || (size == 0 && negative)) {
+      return false;
+    }
+    BigInteger answer;
+    if (size != 0) {
+      size_t done = 0;
+      while (done < size) {
+        size_t chunk = std::min(static_cast<size_t>(size) - done, kFlushBytes / sizeof(Limb));
+        answer.nums_.resize(done + chunk);
+        in.read(reinterpret_cast<char*>(answer.nums_.data() + done), static_cast<std::streamsize>(chunk * sizeof(Limb)));
+        if (!in) {
+          return false;
+        }
+        done += chunk;
+      }
+      if constexpr (std::endian::native == std::endian::big) {
+        for (Limb& limb : answer.nums_) {
+          limb = __builtin_bswap64(limb);
+        }
+      }
+      if (answer.nums_.back() == 0) {
+        return false;
+      }
+      answer.sign_ = negative ? minus : plus;
+    }
+    value = std::move(answer);
+    return true;
+  }
+
+  static bool ReadValue(std::istream& in, Rational& value) {
+    Rational answer;
+    if (!ReadValue(in, answer.up_) || !ReadValue(in, answer.low_) || !IsReduced(answer)) {
+      return false;
+    }
+    value = std::move(answer);
+    return true;
+  }
+
+public:
+  static constexpr uint8_t kVersion = 1;
+  static constexpr size_t kFlushBytes = 1 << 16;
+  static constexpr uint64_t kMaxLimbs = uint64_t(1) << 28;
+
+  static void Write(std::string& out, const BigInteger& value) {
+    out.push_back(static_cast<char>(kVersion));
+    WriteValue(out, value);
+  }
+
+  static void Write(std::string& out, const Rational& value) {
+    out.push_back(static_cast<char>(kVersion));
+    WriteValue(out, value);
+  }
+
+  static bool ReadView(std::string_view& in, BigIntegerView& view) {
+    std::string_view rest = in;
+    if (!ReadVersion(rest) || !ReadValue(rest, view)) {
+      return false;
+    }
+    in = rest;
+    return true;
+  }
+
+  static bool Read(std::string_view& in, BigInteger& value) {
+    std::string_view rest = in;
+    if (!ReadVersion(rest) || !ReadValue(rest, value)) {
+      return false;
+    }
+    in = rest;
+    return true;
+  }
+
+  static bool Read(std::string_view& in, Rational& value) {
+    std::string_view rest = in;
+    if (!ReadVersion(rest) || !ReadValue(rest, value)) {
+      return false;
+    }
+    in = rest;
+    return true;
+  }
+
+  static bool Read(std::istream& in, BigInteger& value) {
+    return in.get() == kVersion && ReadValue(in, value);
+  }
+
+  static bool Read(std::istream& in, Rational& value) {
+    return in.get() == kVersion && ReadValue(in, value);
+  }
+
+  template <typename T>
+  static void WriteAll(std::ostream& out, const std::vector<T>& values) {
+    std::string buffer;
+    buffer.push_back(static_cast<char>(kVersion));
+    WriteVarint(buffer, values.size());
+    for (const T& value : values) {
+      WriteValue(buffer, value);
+      if (buffer.size() >= kFlushBytes) {
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+      }
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+  }
+
+  template <typename T>
+  static bool ReadAll(std::istream& in, std::vector<T>& values) {
+    uint64_t count = 0;
+    bool success = in.get() == kVersion && ReadVarint(in, count);
+    values.clear();
+    for (uint64_t i = 0; success && i < count; ++i) {
+      values.emplace_back();
+      success = ReadValue(in, values.back());
+    }
+    if (!success) {
+      values.clear();
+      in.setstate(std::ios::failbit);
+    }
+    return success;
+  }
+};
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#ifndef BIGINTEGER_HEADER
+#define BIGINTEGER_HEADER "biginteger.h"
+#endif
+#include BIGINTEGER_HEADER
+
+const int kValues = 20000;
+const int kRounds = 5;
+
+BigInteger RandomInteger(std::mt19937_64& generator, size_t max_limbs) {
+  BigInteger shift(static_cast<unsigned long long>(1) << 32);
+  BigInteger answer = 0;
+  size_t limbs = 1 + generator() % max_limbs;
+  for (size_t i = 0; i < limbs; ++i) {
+    answer *= shift;
+    answer *= shift;
+    answer += BigInteger(static_cast<unsigned long long>(generator() >> (generator() % 64)));
+  }
+  return answer;
+}
+
+std::vector<Rational> MakeValues(std::mt19937_64& generator) {
+  std::vector<Rational> values;
+  while (values.size() < kValues) {
+    int kind = static_cast<int>(generator() % 4);
+    BigInteger up = RandomInteger(generator, kind == 0 ? 1 : 6);
+    BigInteger low = RandomInteger(generator, kind == 0 ? 1 : 6);
+    if (low == 0) {
+      low = 1;
+    }
+    if (generator() % 2 == 0) {
+      up = -up;
+    }
+    Rational value = Rational(up) / Rational(low);
+    values.push_back(value);
+    if (kind == 3) {
+      Rational epsilon = Rational(1) / Rational(RandomInteger(generator, 12) + 1);
+      values.push_back(value);
+      values.push_back(value + epsilon);
+      values.push_back(value - epsilon);
+    }
+  }
+  return values;
+}
+
+int main() {
+  std::mt19937_64 generator(11);
+  std::vector<Rational> values = MakeValues(generator);
+  size_t comparisons = 0;
+  double milliseconds = 0;
+  for (int round = 0; round < kRounds; ++round) {
+    std::vector<Rational> shuffled = values;
+    std::shuffle(shuffled.begin(), shuffled.end(), generator);
+    auto start = std::chrono::steady_clock::now();
+    std::sort(shuffled.begin(), shuffled.end(), [&comparisons](const Rational& first, const Rational& second) {
+      ++comparisons;
+      return first < second;
+    });
+    auto finish = std::chrono::steady_clock::now();
+    milliseconds += std::chrono::duration<double, std::milli>(finish - start).count();
+  }
+  std::printf("sorted %zu rationals x%d: %.1f ms per sort, %.1f ns per comparison\n", values.size(), kRounds,
+              milliseconds / kRounds, milliseconds * 1e6 / static_cast<double>(comparisons));
+  return 0;
+}
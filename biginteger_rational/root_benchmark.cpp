@@ -0,0 +1,108 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+#include "biginteger.h"
+
+const size_t kBisectionLimbs = 64;
+
+BigInteger RandomInteger(std::mt19937_64& generator, size_t limbs) {
+  BigInteger shift(static_cast<unsigned long long>(1) << 32);
+  BigInteger answer = 0;
+  for (size_t i = 0; i < limbs; ++i) {
+    answer *= shift;
+    answer *= shift;
+    answer += BigInteger(static_cast<unsigned long long>(generator()));
+  }
+  return answer;
+}
+
+BigInteger Power(const BigInteger& base, uint64_t degree) {
+  BigInteger power = 1;
+  for (uint64_t i = 0; i < degree; ++i) {
+    power *= base;
+  }
+  return power;
+}
+
+BigInteger BisectionRoot(const BigInteger& number, uint64_t degree) {
+  BigInteger low = 0;
+  BigInteger high = 1;
+  while (Power(high, degree) <= number) {
+    high *= 2;
+  }
+  while (high - low > 1) {
+    BigInteger middle = (low + high) / 2;
+    if (Power(middle, degree) <= number) {
+      low = middle;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+template <typename Function>
+double Milliseconds(int repeats, Function function) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < repeats; ++i) {
+    function();
+  }
+  auto finish = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(finish - start).count() / repeats;
+}
+
+int main() {
+  std::mt19937_64 generator(18);
+  std::printf("%8s %6s %12s %12s\n", "limbs", "degree", "newton ms", "bisection ms");
+  for (size_t limbs : {1, 4, 16, 64, 256, 1024, 4096, 16384}) {
+    BigInteger number = RandomInteger(generator, limbs);
+    for (uint64_t degree : {2, 3, 7}) {
+      int repeats = limbs <= 64 ? 200 : limbs <= 1024 ? 10 : 1;
+      BigInteger root;
+      double newton = Milliseconds(repeats, [&] {
+        root = degree == 2 ? isqrt(number) : iroot(number, degree);
+      });
+      if (limbs <= kBisectionLimbs) {
+        BigInteger reference;
+        double bisection = Milliseconds(1, [&] {
+          reference = BisectionRoot(number, degree);
+        });
+        std::printf("%8zu %6llu %12.4f %12.4f%s\n", limbs, static_cast<unsigned long long>(degree), newton, bisection,
+                    root == reference ? "" : "  MISMATCH");
+      } else {
+        std::printf("%8zu %6llu %12.4f %12s\n", limbs, static_cast<unsigned long long>(degree), newton, "-");
+      }
+    }
+  }
+  BigInteger square = RandomInteger(generator, 4096);
+  square *= square;
+  BigInteger other = square + 1;
+  double hit = Milliseconds(10, [&] {
+    is_perfect_square(square);
+  });
+  double miss = Milliseconds(10, [&] {
+    is_perfect_square(other);
+  });
+  std::printf("is_perfect_square on 8192 limbs: square %.4f ms, non-square %.4f ms\n", hit, miss);
+  BigInteger factorial_value = factorial(6000);
+  double factorial_newton = Milliseconds(5, [&] {
+    isqrt(factorial_value);
+  });
+  std::printf("isqrt(6000!): %.4f ms\n", factorial_newton);
+  BigInteger wide = RandomInteger(generator, 4096);
+  for (uint64_t degree : {wide.bit_length() / 2 + 1, wide.bit_length() - 1, uint64_t(1000000000)}) {
+    BigInteger root;
+    double large = Milliseconds(10, [&] {
+      root = iroot(wide, degree);
+    });
+    std::printf("iroot(4096 limbs, %llu): %.4f ms  (%s)\n", static_cast<unsigned long long>(degree), large,
+                root.toString().c_str());
+  }
+  BigInteger small_root;
+  double tiny = Milliseconds(10, [&] {
+    small_root = iroot(BigInteger(5), uint64_t(1) << 34);
+  });
+  std::printf("iroot(5, 2^34): %.4f ms  (%s)\n", tiny, small_root.toString().c_str());
+  return 0;
+}
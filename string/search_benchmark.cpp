@@ -0,0 +1,74 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifndef STRING_HEADER
+#define STRING_HEADER "string.h"
+#endif
+#include STRING_HEADER
+
+const size_t kHaystackBytes = 4 << 20;
+const int kRepeats = 3;
+
+std::string HttpText(std::mt19937& generator) {
+  const char* parts[] = {"GET /api/v1/items?id=", "HTTP/1.1\r\n", "Host: example.org\r\n", "Content-Length: ",
+                         "Accept: application/json\r\n", "user=alice&token=", "\r\n", "0123456789"};
+  std::string text;
+  while (text.size() < kHaystackBytes) {
+    text += parts[generator() % 8];
+  }
+  return text;
+}
+
+std::string WordText(std::mt19937& generator) {
+  const char* words[] = {"the", "of", "and", "a", "to", "in", "is", "you", "that", "it", "he", "was", "for",
+                         "on", "are", "as", "with", "his", "they", "at", "be", "this", "have", "from"};
+  std::string text;
+  while (text.size() < kHaystackBytes) {
+    text += words[generator() % 24];
+    text += generator() % 12 == 0 ? ".\n" : " ";
+  }
+  return text;
+}
+
+std::string AlphabetText(std::mt19937& generator, const char* alphabet, size_t letters) {
+  std::string text(kHaystackBytes, ' ');
+  for (char& symbol : text) {
+    symbol = alphabet[generator() % letters];
+  }
+  return text;
+}
+
+std::string Needle(const std::string& text, size_t length, std::mt19937& generator) {
+  std::string needle = text.substr(text.size() / 2 + generator() % 1024, length);
+  needle.back() = needle.back() == '#' ? '$' : '#';
+  return needle;
+}
+
+void Run(const char* name, const std::string& text, std::mt19937& generator) {
+  String haystack(text.c_str());
+  for (size_t length : {1, 2, 4, 8, 16, 32, 64, 256}) {
+    String missing(Needle(text, length, generator).c_str());
+    String present(text.substr(text.size() - 4096 + generator() % 2048, length).c_str());
+    size_t checksum = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRepeats; ++i) {
+      checksum += haystack.find(missing) + haystack.rfind(missing) + haystack.find(present);
+    }
+    auto finish = std::chrono::steady_clock::now();
+    double milliseconds = std::chrono::duration<double, std::milli>(finish - start).count() / kRepeats;
+    std::printf("%-8s needle %4zu: %9.3f ms  %7.2f GB/s  (%zu)\n", name, length, milliseconds,
+                3.0 * static_cast<double>(text.size()) / milliseconds / 1e6, checksum);
+  }
+}
+
+int main() {
+  std::mt19937 generator(23);
+  Run("http", HttpText(generator), generator);
+  Run("words", WordText(generator), generator);
+  Run("dna", AlphabetText(generator, "ACGT", 4), generator);
+  Run("bytes", AlphabetText(generator, "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789", 62), generator);
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "../benchmark/allocation_counter.h"
+
+#ifndef STRING_HEADER
+#define STRING_HEADER "string.h"
+#endif
+#include STRING_HEADER
+
+const int kIterations = 1000000;
+
+template <typename Operation>
+void Measure(const char* name, Operation operation) {
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  size_t checksum = 0;
+  for (int i = 0; i < kIterations; ++i) {
+    checksum += operation(i);
+  }
+  auto finish = std::chrono::steady_clock::now();
+  double nanoseconds = std::chrono::duration<double, std::nano>(finish - start).count();
+  std::printf("%-14s %6.2f allocations/op %8.1f ns/op  (%zu)\n", name,
+              static_cast<double>(allocations - before) / kIterations, nanoseconds / kIterations, checksum);
+}
+
+int main() {
+  std::printf("sizeof(String) = %zu\n", sizeof(String));
+  const char* keys[] = {"id", "user:1042", "session_token", "a", "content-type", "x-request-id"};
+  Measure("default", [](int) {
+    String value;
+    return value.size();
+  });
+  Measure("from char", [](int i) {
+    String value(static_cast<char>('a' + i % 26));
+    return value.size();
+  });
+  Measure("from cstr", [&keys](int i) {
+    String value(keys[i % 6]);
+    return value.size();
+  });
+  Measure("copy", [&keys](int i) {
+    String value(keys[i % 6]);
+    String copy = value;
+    return copy.size();
+  });
+  Measure("push_back x12", [](int i) {
+    String value('k');
+    for (int j = 0; j < 12; ++j) {
+      value.push_back(static_cast<char>('0' + (i + j) % 10));
+    }
+    return value.size();
+  });
+  Measure("long cstr", [](int) {
+    String value("a key that is too long for any inline buffer");
+    return value.size();
+  });
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  std::vector<String> table;
+  table.reserve(kIterations);
+  for (int i = 0; i < kIterations; ++i) {
+    String key('k');
+    for (int j = 0; j < 10; ++j) {
+      key.push_back(static_cast<char>('0' + (i / (j + 1)) % 10));
+    }
+    table.push_back(key);
+  }
+  auto finish = std::chrono::steady_clock::now();
+  std::printf("%-14s %6.2f allocations/op %8.1f ns/op  (%zu)\n", "key table",
+              static_cast<double>(allocations - before) / kIterations,
+              std::chrono::duration<double, std::nano>(finish - start).count() / kIterations, table.size());
+  return 0;
+}
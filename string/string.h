@@ -1,60 +1,413 @@
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstdint>
 #include <cstring>
 #include <iostream>
+#include <utility>
 
-class String {
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+class SubstringSearch {
 private:
+  static constexpr size_t kHorspoolThreshold = 32;
+
+  static bool Matches(const char* place, const char* needle, size_t count) {
+    return count <= 2 || memcmp(place + 1, needle + 1, count - 2) == 0;
+  }
+
+  static size_t FindFiltered(const char* text, size_t size, const char* needle, size_t count) {
+    size_t position = 0;
+#if defined(__SSE2__)
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[count - 1]);
+    for (; position + count + 15 <= size; position += 16) {
+      __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position));
+      __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position + count - 1));
+      uint32_t mask = static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+      while (mask != 0) {
+        size_t candidate = position + static_cast<size_t>(std::countr_zero(mask));
+        if (Matches(text + candidate, needle, count)) {
+          return candidate;
+        }
+        mask &= mask - 1;
+      }
+    }
+#endif
+    while (position + count <= size) {
+      const char* found = static_cast<const char*>(memchr(text + position, needle[0], size - count + 1 - position));
+      if (found == nullptr) {
+        return size;
+      }
+      position = static_cast<size_t>(found - text);
+      if (text[position + count - 1] == needle[count - 1] && Matches(found, needle, count)) {
+        return position;
+      }
+      ++position;
+    }
+    return size;
+  }
+
+  static size_t RfindFiltered(const char* text, size_t size, const char* needle, size_t count) {
+    size_t end = size - count + 1;
+#if defined(__SSE2__)
+    const __m128i first = _mm_set1_epi8(needle[0]);
+    const __m128i last = _mm_set1_epi8(needle[count - 1]);
+    for (; end >= 16; end -= 16) {
+      size_t position = end - 16;
+      __m128i head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position));
+      __m128i tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + position + count - 1));
+      uint32_t mask = static_cast<uint32_t>(
+          _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(head, first), _mm_cmpeq_epi8(tail, last))));
+      while (mask != 0) {
+        int bit = 31 - std::countl_zero(mask);
+        if (Matches(text + position + bit, needle, count)) {
+          return position + static_cast<size_t>(bit);
+        }
+        mask ^= 1u << bit;
+      }
+    }
+#endif
+    while (end > 0) {
+      --end;
+      if (text[end] == needle[0] && text[end + count - 1] == needle[count - 1] && Matches(text + end, needle, count)) {
+        return end;
+      }
+    }
+    return size;
+  }
+
+  static size_t FindHorspool(const char* text, size_t size, const char* needle, size_t count) {
+    std::array<size_t, 256> shift;
+    shift.fill(count);
+    for (size_t i = 0; i + 1 < count; ++i) {
+      shift[static_cast<unsigned char>(needle[i])] = count - 1 - i;
+    }
+    char last = needle[count - 1];
+    for (size_t position = 0; position + count <= size;) {
+      char symbol = text[position + count - 1];
+      if (symbol == last && memcmp(text + position, needle, count - 1) == 0) {
+        return position;
+      }
+      position += shift[static_cast<unsigned char>(symbol)];
+    }
+    return size;
+  }
+
+  static size_t RfindHorspool(const char* text, size_t size, const char* needle, size_t count) {
+    std::array<size_t, 256> shift;
+    shift.fill(count);
+    for (size_t i = count - 1; i > 0; --i) {
+      shift[static_cast<unsigned char>(needle[i])] = i;
+    }
+    char first = needle[0];
+    for (size_t position = size - count;;) {
+      char symbol = text[position];
+      if (symbol == first && memcmp(text + position + 1, needle + 1, count - 1) == 0) {
+        return position;
+      }
+      size_t step = shift[static_cast<unsigned char>(symbol)];
+      if (position < step) {
+        return size;
+      }
+      position -= step;
+    }
+  }
+
+public:
+  static size_t Find(const char* text, size_t size, const char* needle, size_t count) {
+    if (count > size) {
+      return size;
+    }
+    if (count == 0) {
+      return 0;
+    }
+    if (count == 1) {
+      const char* found = static_cast<const char*>(memchr(text, needle[0], size));
+      return found == nullptr ? size : static_cast<size_t>(found - text);
+    }
+    if (count >= kHorspoolThreshold) {
+      return FindHorspool(text, size, needle, count);
+    }
+    return FindFiltered(text, size, needle, count);
+  }
+
+  static size_t Rfind(const char* text, size_t size, const char* needle, size_t count) {
+    if (count > size || count == 0) {
+      return size;
+    }
+    if (count >= kHorspoolThreshold) {
+      return RfindHorspool(text, size, needle, count);
+    }
+    return RfindFiltered(text, size, needle, count);
+  }
+};
+
+class StringView {
+private:
+  const char* ptr;
   size_t sz;
-  size_t cap;
-  char* arr;
 
-  explicit String(size_t count, bool) : sz(count), cap(sz + 1), arr(new char[sz + 1]) {
-    arr[count] = '\0';
+public:
+  StringView() : ptr(""), sz(0) {}
+
+  StringView(const char* cstr) : ptr(cstr), sz(strlen(cstr)) {}
+
+  StringView(const char* data, size_t count) : ptr(data), sz(count) {}
+
+  const char& operator[](size_t index) const {
+    return ptr[index];
+  }
+
+  size_t length() const {
+    return sz;
+  }
+
+  size_t size() const {
+    return sz;
+  }
+
+  bool empty() const {
+    return !sz;
+  }
+
+  const char& front() const {
+    return ptr[0];
+  }
+
+  const char& back() const {
+    return ptr[sz - 1];
+  }
+
+  const char* data() const {
+    return ptr;
+  }
+
+  size_t find(StringView substring) const {
+    return SubstringSearch::Find(ptr, sz, substring.ptr, substring.sz);
+  }
+
+  size_t find(char symbol) const {
+    return SubstringSearch::Find(ptr, sz, &symbol, 1);
+  }
+
+  size_t rfind(StringView substring) const {
+    return SubstringSearch::Rfind(ptr, sz, substring.ptr, substring.sz);
+  }
+
+  size_t rfind(char symbol) const {
+    return SubstringSearch::Rfind(ptr, sz, &symbol, 1);
+  }
+
+  StringView substr(size_t start, size_t count) const {
+    return StringView(ptr + start, std::min(count, sz - start));
+  }
+};
+
+bool operator==(StringView first, StringView second) {
+  return first.size() == second.size() && memcmp(first.data(), second.data(), first.size()) == 0;
+}
+
+std::strong_ordering operator<=>(StringView first, StringView second) {
+  int result = memcmp(first.data(), second.data(), std::min(first.size(), second.size()));
+  if (result != 0) {
+    return result <=> 0;
+  }
+  return first.size() <=> second.size();
+}
+
+bool operator==(StringView first, char second) {
+  return first == StringView(&second, 1);
+}
+
+std::strong_ordering operator<=>(StringView first, char second) {
+  return first <=> StringView(&second, 1);
+}
+
+std::ostream& operator<<(std::ostream& out, StringView other) {
+  out.write(other.data(), static_cast<std::streamsize>(other.size()));
+  return out;
+}
+
+class String {
+private:
+  static constexpr size_t kLocalBytes = 16;
+
+  struct Heap {
+    char* arr;
+    size_t cap;
+  };
+
+  size_t sz : 63;
+  size_t spilled : 1;
+  union {
+    Heap heap;
+    char buffer[kLocalBytes];
+  };
+
+  explicit String(size_t count, bool) : sz(count), spilled(count >= kLocalBytes) {
+    if (spilled) {
+      heap.arr = new char[count + 1];
+      heap.cap = count + 1;
+    }
+    data()[count] = '\0';
+  }
+
+  size_t allocated() const {
+    return spilled ? heap.cap : kLocalBytes;
+  }
+
+  void reallocate(size_t bytes) {
+    if (bytes <= kLocalBytes) {
+      if (spilled) {
+        char* cstr = heap.arr;
+        memcpy(buffer, cstr, sz + 1);
+        spilled = false;
+        delete[] cstr;
+      }
+      return;
+    }
+    char* cstr = new char[bytes];
+    memcpy(cstr, data(), sz + 1);
+    if (spilled) {
+      delete[] heap.arr;
+    }
+    heap.arr = cstr;
+    heap.cap = bytes;
+    spilled = true;
+  }
+
+  void append(const char* cstr, size_t count) {
+    if (allocated() < sz + count + 1) {
+      size_t bytes = 2 * (sz + count) + 1;
+      char* fresh = new char[bytes];
+      memcpy(fresh, data(), sz);
+      memcpy(&fresh[sz], cstr, count);
+      if (spilled) {
+        delete[] heap.arr;
+      }
+      heap.arr = fresh;
+      heap.cap = bytes;
+      spilled = true;
+    } else {
+      memcpy(data() + sz, cstr, count);
+    }
+    sz += count;
+    data()[sz] = '\0';
+  }
+
+  static std::pair<const char*, size_t> piece(StringView other) {
+    return {other.data(), other.size()};
+  }
+
+  static std::pair<const char*, size_t> piece(const char& symbol) {
+    return {&symbol, 1};
   }
 
 public:
   String(char symbol) : String(1, true) {
-    arr[0] = symbol;
+    data()[0] = symbol;
   }
 
   String(const char* cstr) : String(strlen(cstr), true) {
-    memcpy(arr, cstr, strlen(cstr) + 1);
+    memcpy(data(), cstr, sz + 1);
   }
 
   String(size_t count, char symbol) : String(count, true) {
-    memset(arr, symbol, count);
-    arr[count] = '\0';
+    memset(data(), symbol, count);
+    data()[count] = '\0';
   }
 
   String() : String(0, true) {
-    arr[0] = '\0';
+    data()[0] = '\0';
+  }
+
+  explicit String(StringView other) : String(other.size(), true) {
+    memcpy(data(), other.data(), sz);
   }
 
-  String(const String& other) : sz(other.sz), cap(other.cap), arr(new char[other.cap]) {
-    memcpy(arr, other.arr, other.sz + 1);
+  String(const String& other) : String(other.sz, true) {
+    memcpy(data(), other.data(), other.sz + 1);
   }
 
   void swap(String& other) {
-    std::swap(other.arr, arr);
-    std::swap(other.sz, sz);
-    std::swap(other.cap, cap);
+    if (spilled && other.spilled) {
+      std::swap(other.heap, heap);
+    } else if (!spilled && !other.spilled) {
+      std::swap(other.buffer, buffer);
+    } else {
+      String& local = spilled ? other : *this;
+      String& remote = spilled ? *this : other;
+      Heap moved = remote.heap;
+      memcpy(remote.buffer, local.buffer, local.sz + 1);
+      local.heap = moved;
+    }
+    size_t size = sz;
+    sz = other.sz;
+    other.sz = size;
+    size_t flag = spilled;
+    spilled = other.spilled;
+    other.spilled = flag;
+  }
+
+  String(String&& other) noexcept : String(0, true) {
+    swap(other);
   }
 
   String& operator=(const String& other) {
     if (this == &other) {
       return *this;
     }
-    String answer(other.sz, true);
-    memcpy(answer.data(), other.data(), other.sz + 1);
-    swap(answer);
+    if (allocated() <= other.sz) {
+      String answer(other);
+      swap(answer);
+      return *this;
+    }
+    memcpy(data(), other.data(), other.sz + 1);
+    sz = other.sz;
+    return *this;
+  }
+
+  String& operator=(String&& other) noexcept {
+    if (this == &other) {
+      return *this;
+    }
+    if (spilled) {
+      delete[] heap.arr;
+      spilled = false;
+    }
+    sz = 0;
+    buffer[0] = '\0';
+    swap(other);
     return *this;
   }
 
+  template <typename... Pieces>
+  static String concat(const Pieces&... pieces) {
+    std::array<std::pair<const char*, size_t>, sizeof...(Pieces)> parts = {piece(pieces)...};
+    size_t total = 0;
+    for (const auto& part : parts) {
+      total += part.second;
+    }
+    String answer(total, true);
+    size_t offset = 0;
+    for (const auto& part : parts) {
+      memcpy(answer.data() + offset, part.first, part.second);
+      offset += part.second;
+    }
+    return answer;
+  }
+
   char& operator[](size_t index) {
-    return arr[index];
+    return data()[index];
   }
 
   const char& operator[](size_t index) const {
-    return arr[index];
+    return data()[index];
   }
 
   size_t length() const {
@@ -66,60 +419,44 @@ public:
   }
 
   size_t capacity() const {
-    return cap - 1;
+    return allocated() - 1;
   }
 
   void push_back(char symbol) {
-    if (sz < cap - 1) {
-      arr[sz++] = symbol;
-      arr[sz] = '\0';
-    } else {
-      char* cstr = new char[cap * 2];
-      memcpy(cstr, arr, sz);
-      cstr[sz] = symbol;
-      cstr[++sz] = '\0';
-      std::swap(arr, cstr);
-      cap *= 2;
-      delete[] cstr;
+    size_t size = sz;
+    if (size + 1 >= allocated()) {
+      reallocate(allocated() * 2);
     }
+    char* place = data();
+    place[size] = symbol;
+    place[size + 1] = '\0';
+    sz = size + 1;
   }
 
   void pop_back() {
     if (sz != 0) {
-      arr[--sz] = '\0';
+      data()[--sz] = '\0';
     }
   }
 
   const char& front() const {
-    return arr[0];
+    return data()[0];
   }
 
   char& front() {
-    return arr[0];
+    return data()[0];
   }
 
   const char& back() const {
-    return arr[sz - 1];
+    return data()[sz - 1];
   }
 
   char& back() {
-    return arr[sz - 1];
+    return data()[sz - 1];
   }
 
-  String& operator+=(const String& other) {
-    if (cap >= sz + other.sz + 1) {
-      memcpy(&arr[sz], other.arr, other.sz);
-      sz += other.sz;
-      arr[sz] = '\0';
-      return *this;
-    }
-    char* cstr = new char[2 * (sz + other.sz + 1)];
-    memcpy(cstr, arr, sz);
-    memcpy(&cstr[sz], other.arr, other.sz);
-    std::swap(cstr, arr);
-    sz += other.sz;
-    cap = 2 * sz + 1;
-    arr[sz] = '\0';
+  String& operator+=(StringView other) {
+    append(other.data(), other.size());
     return *this;
   }
 
@@ -128,34 +465,30 @@ public:
     return *this;
   }
 
-  size_t find(const String& substring) const {
-    if (substring.sz > sz) {
-      return sz;
-    }
-    for (size_t i = 1; i <= sz - substring.sz + 1; ++i) {
-      if (memcmp(substring.arr, &arr[i - 1], substring.sz) == 0) {
-        return i - 1;
-      }
-    }
-    return sz;
+  size_t find(StringView substring) const {
+    return SubstringSearch::Find(data(), sz, substring.data(), substring.size());
   }
 
-  size_t rfind(const String& substring) const {
-    if (substring.sz > sz) {
-      return sz;
-    }
-    for (size_t i = sz - substring.sz + 1; i > 0; --i) {
-      if (memcmp(substring.arr, &arr[i - 1], substring.sz) == 0) {
-        return i - 1;
-      }
-    }
-    return sz;
+  size_t find(char symbol) const {
+    return SubstringSearch::Find(data(), sz, &symbol, 1);
+  }
+
+  size_t rfind(StringView substring) const {
+    return SubstringSearch::Rfind(data(), sz, substring.data(), substring.size());
+  }
+
+  size_t rfind(char symbol) const {
+    return SubstringSearch::Rfind(data(), sz, &symbol, 1);
+  }
+
+  StringView view(size_t start, size_t count) const {
+    return StringView(data() + start, std::min(count, sz - start));
   }
 
   String substr(size_t start, size_t count) const {
     count = std::min(count, sz - start);
     String answer(count, true);
-    memcpy(answer.arr, &arr[start], count);
+    memcpy(answer.data(), data() + start, count);
     answer[count] = '\0';
     return answer;
   }
@@ -166,83 +499,56 @@ public:
 
   void clear() {
     sz = 0;
-    arr[0] = '\0';
+    data()[0] = '\0';
   }
 
   void shrink_to_fit() {
-    char* cstr = new char[sz + 1];
-    memcpy(cstr, arr, sz);
-    cstr[sz] = '\0';
-    std::swap(arr, cstr);
-    cap = sz + 1;
-    delete[] cstr;
+    if (spilled && sz + 1 < heap.cap) {
+      reallocate(sz + 1);
+    }
   }
 
   char* data() {
-    return &arr[0];
+    return spilled ? heap.arr : buffer;
   }
 
   const char* data() const {
-    return &arr[0];
+    return spilled ? heap.arr : buffer;
   }
 
-  ~String() {
-    delete[] arr;
+  operator StringView() const {
+    return StringView(data(), sz);
   }
 
-  friend std::istream& operator>>(std::istream&, String&);
-};
-
-bool operator<(const String& first, const String& second) {
-  if (first.size() < second.size()) {
-    for (size_t i = 0; i < first.size(); ++i) {
-      if (first[i] < second[i]) {
-        return true;
-      }
-      if (first[i] > second[i]) {
-        return false;
-      }
-    }
-    return true;
-  }
-  for (size_t i = 0; i < second.size(); ++i) {
-    if (first[i] < second[i]) {
-      return true;
-    }
-    if (first[i] > second[i]) {
-      return false;
+  ~String() {
+    if (spilled) {
+      delete[] heap.arr;
     }
   }
-  return false;
-}
-
-bool operator>(const String& first, const String& second) {
-  return second < first;
-}
 
-bool operator<=(const String& first, const String& second) {
-  return !(first > second);
-}
+  friend std::istream& operator>>(std::istream&, String&);
+};
 
-bool operator>=(const String& first, const String& second) {
-  return !(first < second);
+String operator+(const String& first, const String& second) {
+  return String::concat(first, second);
 }
 
-bool operator==(const String& first, const String& second) {
-  return first >= second && first <= second;
+String operator+(String&& first, const String& second) {
+  first += second;
+  return std::move(first);
 }
 
-bool operator!=(const String& first, const String& second) {
-  return !(first == second);
+String operator+(const String& first, String&& second) {
+  return String::concat(first, second);
 }
 
-String operator+(String first, const String& second) {
+String operator+(String&& first, String&& second) {
   first += second;
-  return first;
+  return std::move(first);
 }
 
 String operator+(char symbol, const String& other) {
-  return String(1, symbol) + other;
+  return String::concat(symbol, other);
 }
 
 std::istream& operator>>(std::istream& in, String& other) {